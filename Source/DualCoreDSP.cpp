@@ -1,5 +1,173 @@
 #include "DualCoreDSP.h"
 #include <random>
+#include <cstring>
+
+namespace
+{
+    // Fast 2^x (~0.02% error). Branch-free, so it auto-vectorises and is far
+    // cheaper than std::exp2/std::pow for per-sample pitch modulation
+    inline float fastExp2(float x)
+    {
+        x = juce::jlimit(-126.0f, 126.0f, x);
+        float whole = std::floor(x);
+        float frac = x - whole;
+
+        // Polynomial for 2^frac on [0, 1)
+        float mantissa = 1.0f + frac * (0.6960656f + frac * (0.2244943f + frac * 0.0794402f));
+
+        int32_t bits = (static_cast<int32_t>(whole) + 127) << 23;
+        float exponent;
+        std::memcpy(&exponent, &bits, sizeof(float));
+        return mantissa * exponent;
+    }
+
+    // SVF frequency coefficient 2*sin(pi * fc) for fc = 0 to 0.5, as an odd minimax
+    // polynomial for sin on [0, pi/2] (~3e-6 relative error, far below audible for FM).
+    // No table reads or branches, so audio-rate FM can update coefficients every
+    // sample and the lane loops vectorise
+    inline float svfFrequencyCoefficient(float normalisedFreq)
+    {
+        const float x = juce::jlimit(0.0f, 0.5f, normalisedFreq) * juce::MathConstants<float>::pi;
+        const float x2 = x * x;
+        return 2.0f * x * (0.9999966f + x2 * (-0.16664824f + x2 * (0.00830629f + x2 * -0.00018363f)));
+    }
+
+    // Two-sample polynomial residual of a band-limited step at phase 0 (PolyBLEP)
+    inline float polyBLEP(float t, float dt)
+    {
+        if (t < dt)
+        {
+            t /= dt;
+            return t + t - t * t - 1.0f;
+        }
+        if (t > 1.0f - dt)
+        {
+            t = (t - 1.0f) / dt;
+            return t * t + t + t + 1.0f;
+        }
+        return 0.0f;
+    }
+
+    // Polyphase branches of a 4x Kaiser-windowed sinc interpolator (48 taps, as in
+    // ITU-R BS.1770), used for true-peak estimation in the limiter detector
+    struct TruePeakInterpolator
+    {
+        static constexpr int phases = 4;
+        static constexpr int taps = 12;
+        float coefficients[phases][taps];
+
+        TruePeakInterpolator()
+        {
+            const int length = phases * taps;
+            const float centre = static_cast<float>(length - 1) * 0.5f;
+            const double beta = 4.0;
+
+            for (int phase = 0; phase < phases; ++phase)
+            {
+                float sum = 0.0f;
+                for (int tap = 0; tap < taps; ++tap)
+                {
+                    const int n = tap * phases + phase;
+                    const float x = (static_cast<float>(n) - centre) / static_cast<float>(phases);
+                    const float sinc = std::abs(x) < 1.0e-6f ? 1.0f
+                        : std::sin(juce::MathConstants<float>::pi * x) / (juce::MathConstants<float>::pi * x);
+                    const double r = 2.0 * n / (length - 1) - 1.0;
+                    const float window = static_cast<float>(besselI0(beta * std::sqrt(1.0 - r * r)) / besselI0(beta));
+                    coefficients[phase][tap] = sinc * window;
+                    sum += coefficients[phase][tap];
+                }
+
+                // Unity DC gain per branch
+                for (int tap = 0; tap < taps; ++tap)
+                    coefficients[phase][tap] /= sum;
+            }
+        }
+
+        static double besselI0(double x)
+        {
+            double sum = 1.0, term = 1.0;
+            for (int k = 1; k < 30; ++k)
+            {
+                term *= (x / (2.0 * k)) * (x / (2.0 * k));
+                sum += term;
+            }
+            return sum;
+        }
+    };
+
+    const TruePeakInterpolator truePeakInterpolator;
+
+    // === Saturation helpers shared by the filter cores ===
+
+    inline float tanhApprox(float x)
+    {
+        // Fast tanh approximation. The rational curve reaches exactly +/-1 at +/-3,
+        // so clamping the input replaces the saturation branches (vectorises in lanes)
+        x = juce::jlimit(-3.0f, 3.0f, x);
+        float x2 = x * x;
+        return x * (27.0f + x2) / (27.0f + 9.0f * x2);
+    }
+
+    inline float softClip(float x)
+    {
+        // Soft saturation curve
+        return x / (1.0f + std::abs(x));
+    }
+
+    inline float diodeClip(float x)
+    {
+        // Asymmetric diode-style clipping (sharper than tanh)
+        if (x > 0.0f)
+            return 1.0f - std::exp(-x * 1.5f);
+        else
+            return -1.0f + std::exp(x * 1.2f);
+    }
+
+    // Morph weights: blend the two neighbouring taps (LP -> BP -> HP -> Notch)
+    inline void computeTapGains(float position, float* gains)
+    {
+        int index = juce::jlimit(0, 2, static_cast<int>(position));
+        float frac = juce::jlimit(0.0f, 1.0f, position - static_cast<float>(index));
+
+        for (int tap = 0; tap < 4; ++tap)
+            gains[tap] = 0.0f;
+        gains[index] = 1.0f - frac;
+        gains[index + 1] = frac;
+    }
+
+    // Triangle folder: reflects at +/-1 as often as needed, so every further 2 of gain
+    // past unity adds a fold (the limit of a Serge-style chain of folding stages). Period 4
+    inline float foldTriangle(float x)
+    {
+        const float u = x + 1.0f;
+        return 1.0f - std::abs(u - 4.0f * std::floor(u * 0.25f) - 2.0f);
+    }
+
+    // Its antiderivative, also periodic (piecewise quadratic), so large inputs stay exact
+    inline float foldTriangleIntegral(float x)
+    {
+        const float u = x + 1.0f;
+        const float phase = u - 4.0f * std::floor(u * 0.25f);
+        return phase < 2.0f ? 0.5f * (phase - 1.0f) * (phase - 1.0f)
+                            : 1.0f - 0.5f * (3.0f - phase) * (3.0f - phase);
+    }
+
+    // Resonance make-up gain (dB) per filter type, at resonance 0, 1/8 ... 1. Each entry undoes
+    // the core's level change against its own level at zero resonance, measured on low-pass
+    // filtered noise (-12 dBFS RMS) and averaged over cutoffs from 150 Hz to 5 kHz. The MS-20
+    // entry at 0.75 sits on its fold threshold, so it is taken from the points either side;
+    // SVF self-oscillation is limited to a 12 dB cut
+    constexpr int RESO_COMP_POINTS = 9;
+    constexpr float resoCompTableDb[][RESO_COMP_POINTS] = {
+        {0.0f, -0.3f, -0.7f, -1.1f, -1.7f, -2.4f, -3.5f, -5.6f, -12.0f},  // SVF
+        {0.0f,  0.7f,  1.2f,  1.7f,  2.1f,  2.4f,  2.7f,  2.9f,   3.0f},  // Ladder
+        {0.0f, -0.5f, -1.0f, -0.6f, -1.0f, -1.4f, -1.9f, -2.3f,  -2.7f},  // Diode
+        {0.0f,  0.4f,  1.7f,  3.1f,  4.2f,  4.7f,  3.8f,  1.7f,   0.0f},  // MS-20
+        {0.0f,  2.2f,  3.8f,  5.0f,  6.0f,  6.8f,  7.5f,  8.2f,   8.7f},  // Steiner
+        {0.0f,  2.7f,  4.6f,  6.1f,  7.4f,  8.4f,  9.1f,  9.2f,   9.3f},  // OTA
+    };
+    static_assert(std::size(resoCompTableDb) == DualCoreDSP::NUM_FILTER_TYPES, "One row per filter type");
+}
 
 void DualCoreDSP::prepare(double newSampleRate, int samplesPerBlock)
 {
@@ -15,16 +183,29 @@ void DualCoreDSP::prepare(double newSampleRate, int samplesPerBlock)
     oversampling->initProcessing(static_cast<size_t>(samplesPerBlock));
 
     // Initialize filters
-    filter1L.updateCoefficients(sampleRate);
-    filter1R.updateCoefficients(sampleRate);
-    filter2L.updateCoefficients(sampleRate);
-    filter2R.updateCoefficients(sampleRate);
+    for (auto& state : channelStates)
+        for (auto& filter : state.filters)
+            filter.updateCoefficients(sampleRate);
+
+    // Type crossfade length
+    const int fadeSamples = juce::jmax(1, static_cast<int>(sampleRate * TYPE_CROSSFADE_MS * 0.001));
+    filter1Fade.lengthSamples = fadeSamples;
+    filter2Fade.lengthSamples = fadeSamples;
 
     // Initialize envelope followers
     inputEnvFollower.setAttack(1.0f, sampleRate);
     inputEnvFollower.setRelease(50.0f, sampleRate);
-    amEnvFollower.setAttack(5.0f, sampleRate);
-    amEnvFollower.setRelease(100.0f, sampleRate);
+    spectralFollower.prepare(sampleRate);
+
+    // Random walk: unit stationary variance from uniform steps (variance 1/3)
+    constexpr double driftTimeConstant = 3.0;
+    driftWalkDecay = static_cast<float>(DRIFT_INTERVAL / (driftTimeConstant * sampleRate));
+    driftWalkNoise = std::sqrt(2.0f * driftWalkDecay * 3.0f);
+    for (auto& state : channelStates)
+    {
+        state.amFollower.setAttack(5.0f, sampleRate);
+        state.amFollower.setRelease(100.0f, sampleRate);
+    }
 
     // Initialize ADSR
     adsrEnv.setAttack(10.0f, sampleRate);
@@ -35,273 +216,553 @@ void DualCoreDSP::prepare(double newSampleRate, int samplesPerBlock)
     // Initialize LFOs
     lfo.setRate(1.0f, sampleRate);
     lfo2.setRate(1.0f, sampleRate);
-
-    // Initialize shelf filters
-    hiBoostL.setHighShelf(3000.0f, 6.0f, sampleRate);
-    hiBoostR.setHighShelf(3000.0f, 6.0f, sampleRate);
-    hiCutL.setLowShelf(8000.0f, -12.0f, sampleRate);
-    hiCutR.setLowShelf(8000.0f, -12.0f, sampleRate);
+    sequencerSlewCoef = 1.0f - std::exp(-1.0f / (0.001f * static_cast<float>(sampleRate)));
+
+    // Input EQ and crossover coefficients depend on the sample rate
+    inputEQ.dirty = true;
+    updateCrossover();
+
+    // Lookahead delay lines (sized for the maximum so changing it never allocates)
+    const int maxLookahead = static_cast<int>(std::ceil(sampleRate * MAX_LOOKAHEAD_MS * 0.001));
+    for (auto& state : channelStates)
+        state.lookahead.prepare(maxLookahead);
+    sidechainLookahead.prepare(maxLookahead);
+    setLookahead(lookaheadMs);
+
+    const int maxFeedbackDelay = static_cast<int>(std::ceil(sampleRate * MAX_FEEDBACK_DELAY_MS * 0.001));
+    for (auto& state : channelStates)
+        state.feedbackDelay.prepare(maxFeedbackDelay);
+    setFeedback(feedbackAmount, feedbackDelayMs);
+
+    detectorLevels.assign(static_cast<size_t>(samplesPerBlock), 0.0f);
+    sidechainMono.assign(static_cast<size_t>(samplesPerBlock), 0.0f);
+    msScratch.assign(static_cast<size_t>(samplesPerBlock), 0.0f);
+    sequencerBlock.assign(static_cast<size_t>(samplesPerBlock), 0.0f);
+
+    // True-peak limiters (dry and bypass delays match the limiter latencies)
+    for (auto& state : channelStates)
+    {
+        state.inputLimiter.prepare(sampleRate);
+        state.outputLimiter.prepare(sampleRate);
+        state.limiterDry.prepare(state.inputLimiter.getLatencySamples());
+        state.limiterDry.setDelay(state.inputLimiter.getLatencySamples());
+        state.bypassDelay.prepare(state.outputLimiter.getLatencySamples());
+        state.bypassDelay.setDelay(state.outputLimiter.getLatencySamples());
+        for (auto& delay : state.tapDelays)
+        {
+            delay.prepare(state.outputLimiter.getLatencySamples());
+            delay.setDelay(state.outputLimiter.getLatencySamples());
+        }
+    }
 
     reset();
 }
 
 void DualCoreDSP::reset()
 {
-    filter1L.reset();
-    filter1R.reset();
-    filter2L.reset();
-    filter2R.reset();
+    // Drop any crossfade in progress and settle on the requested types
+    filter1Fade.samplesRemaining = 0;
+    filter2Fade.samplesRemaining = 0;
+    for (auto& state : channelStates)
+    {
+        state.filters[0].type = filter1Fade.requestedType;
+        state.filters[1].type = filter2Fade.requestedType;
+        for (auto& filter : state.filters)
+            filter.reset();
+
+        state.unison[0].type = filter1Fade.requestedType;
+        state.unison[1].type = filter2Fade.requestedType;
+        for (auto& lanes : state.unison)
+            lanes.reset();
+
+        state.poly[0].type = filter1Fade.requestedType;
+        state.poly[1].type = filter2Fade.requestedType;
+        for (auto& lanes : state.poly)
+            lanes.reset();
+
+        state.bands[0].type = filter1Fade.requestedType;
+        state.bands[1].type = filter2Fade.requestedType;
+        for (auto& lanes : state.bands)
+            lanes.reset();
+        state.crossover.reset();
+
+        state.cascade[0].type = filter1Fade.requestedType;
+        state.cascade[1].type = filter2Fade.requestedType;
+        for (auto& filter : state.cascade)
+            filter.reset();
+        state.feedbackDelay.reset();
+        state.feedbackSample = 0.0f;
+        state.lastOutput = {};
+
+        state.amFollower.reset();
+        state.preDrive.reset();
+        state.postDrive.reset();
+        for (auto& drive : state.bandDrive)
+            drive.reset();
+        state.lookahead.reset();
+        state.limiterDry.reset();
+        state.bypassDelay.reset();
+        for (auto& delay : state.tapDelays)
+            delay.reset();
+        state.inputLimiter.reset();
+        state.outputLimiter.reset();
+    }
+
     adsrEnv.reset();
+    polyVoices.reset();
+    unisonLayout = unisonTarget;
+    unisonLayoutChanged = unisonRamping = false;
     lfo.reset();
     lfo2.reset();
+    lfoBlockPos = lfoBlockLength = 0;
+    lfo1RateMod = lfo2RateMod = 0.0f;
+    sequencerPpq = 0.0;
+    sequencerSlewState = -1.0f;
+    snapshotPpq = 0.0;
+    snapshotFade = 1.0f;
+    fadeFromRouting = nullptr;
+    snapshotSwitchSample = -1;
     inputEnvFollower.reset();
-    amEnvFollower.reset();
-    hiBoostL.reset();
-    hiBoostR.reset();
-    hiCutL.reset();
-    hiCutR.reset();
+    spectralFollower.reset();
+    seedDrift();  // Renders from a reset drift the same way every time
+    inputEQ.reset();
+    sidechainLookahead.reset();
     envTriggered = false;
+    heldNotes.reset();
+    splitFilter1Output = 0.0f;
     lastInputLevel = 0.0f;
 
     if (oversampling)
         oversampling->reset();
 }
 
-void DualCoreDSP::process(juce::AudioBuffer<float>& buffer)
+void DualCoreDSP::process(juce::AudioBuffer<float>& buffer, const juce::AudioBuffer<float>* sidechain,
+                          const juce::MidiBuffer* midi)
 {
-    const int numChannels = buffer.getNumChannels();
     const int numSamples = buffer.getNumSamples();
+    const int chunkSize = juce::jmax(1, static_cast<int>(detectorLevels.size()));
+
+    if (numSamples <= chunkSize)
+    {
+        processChunk(buffer, sidechain, midi, 0);
+        return;
+    }
+
+    // Hosts may exceed the prepared block size: run the block in chunks of that size, so
+    // the block buffers never reallocate on the audio thread. Sub-buffers only refer to
+    // the host data; the aux destinations and the host position advance with each chunk
+    const auto blockTapOutputs = tapOutputs;
+    const auto blockDryOutputs = dryOutputs;
+    const double blockPpq = hostPpq;
+    const double quartersPerSample = hostBPM / (60.0 * sampleRate);
+
+    for (int start = 0; start < numSamples; start += chunkSize)
+    {
+        const int length = juce::jmin(chunkSize, numSamples - start);
+        juce::AudioBuffer<float> chunk(buffer.getArrayOfWritePointers(), buffer.getNumChannels(), start, length);
+
+        // The sidechain is only read (no channels when there is none)
+        juce::AudioBuffer<float> sidechainChunk(
+            sidechain != nullptr ? const_cast<float* const*>(sidechain->getArrayOfReadPointers()) : buffer.getArrayOfWritePointers(),
+            sidechain != nullptr ? sidechain->getNumChannels() : 0, start, length);
+
+        for (size_t filterIndex = 0; filterIndex < tapOutputs.size(); ++filterIndex)
+        {
+            for (size_t ch = 0; ch < tapOutputs[filterIndex].size(); ++ch)
+            {
+                const TapOutputs& from = blockTapOutputs[filterIndex][ch];
+                TapOutputs& to = tapOutputs[filterIndex][ch];
+                to.lowpass = from.lowpass != nullptr ? from.lowpass + start : nullptr;
+                to.bandpass = from.bandpass != nullptr ? from.bandpass + start : nullptr;
+                to.highpass = from.highpass != nullptr ? from.highpass + start : nullptr;
+                to.notch = from.notch != nullptr ? from.notch + start : nullptr;
+                to.filtered = from.filtered != nullptr ? from.filtered + start : nullptr;
+            }
+        }
+        for (size_t ch = 0; ch < dryOutputs.size(); ++ch)
+            dryOutputs[ch] = blockDryOutputs[ch] != nullptr ? blockDryOutputs[ch] + start : nullptr;
+
+        hostPpq = blockPpq + quartersPerSample * start;
+        processChunk(chunk, sidechain != nullptr ? &sidechainChunk : nullptr, midi, start);
+    }
+
+    tapOutputs = blockTapOutputs;
+    dryOutputs = blockDryOutputs;
+    hostPpq = blockPpq;
+}
+
+void DualCoreDSP::processChunk(juce::AudioBuffer<float>& buffer, const juce::AudioBuffer<float>* sidechain,
+                               const juce::MidiBuffer* midi, int midiOffset)
+{
+    const int numChannels = juce::jmin(buffer.getNumChannels(), MAX_CHANNELS);
+    const int numSamples = buffer.getNumSamples();
+    jassert(static_cast<size_t>(numSamples) <= detectorLevels.size());
+
+    // EQ lanes rounded up to a whole vector (4 floats); unused lanes carry silence
+    const int numEQLanes = juce::jmin((numChannels + 3) & ~3, MAX_CHANNELS);
+
+    if (inputEQ.dirty)
+        inputEQ.updateCoefficients(sampleRate);
+
+    // Limiters and lookahead switched back on start from silence rather than the audio
+    // they held when they were switched off
+    if (inputLimiterResetPending)
+    {
+        for (auto& state : channelStates)
+        {
+            state.inputLimiter.reset();
+            state.limiterDry.reset();
+        }
+        inputLimiterResetPending = false;
+    }
+    if (outputLimiterResetPending)
+    {
+        for (auto& state : channelStates)
+        {
+            state.outputLimiter.reset();
+            state.bypassDelay.reset();
+            for (auto& delay : state.tapDelays)
+                delay.reset();
+        }
+        outputLimiterResetPending = false;
+    }
+    if (lookaheadResetPending)
+    {
+        for (auto& state : channelStates)
+            state.lookahead.reset();
+        sidechainLookahead.reset();
+        lookaheadResetPending = false;
+    }
+
+    // === Block-wise detector ===
+    // Mono sums of the main input (with input gain) and the sidechain, then the input
+    // follower over the chosen one. Undelayed, so it leads the lookahead audio path
+    const bool hasSidechain = sidechain != nullptr && sidechain->getNumChannels() > 0;
+    if (hasSidechain)
+        computeMonoSum(*sidechain, numSamples, 1.0f, sidechainMono.data());
+    else
+        juce::FloatVectorOperations::clear(sidechainMono.data(), numSamples);
+
+    if (detectorSource == DetectorSource::Sidechain)
+        juce::FloatVectorOperations::copy(detectorLevels.data(), sidechainMono.data(), numSamples);
+    else
+        computeMonoSum(buffer, numSamples, inputGain, detectorLevels.data());
+
+    // Band followers: msScratch is free until the M/S encode below
+    if (spectralRouted)
+    {
+        juce::FloatVectorOperations::copy(msScratch.data(), detectorLevels.data(), numSamples);
+        spectralFollower.process(msScratch.data(), numSamples);
+    }
+
+    juce::FloatVectorOperations::abs(detectorLevels.data(), detectorLevels.data(), numSamples);
+    for (int sample = 0; sample < numSamples; ++sample)
+        detectorLevels[static_cast<size_t>(sample)] = inputEnvFollower.process(detectorLevels[static_cast<size_t>(sample)]);
+
+    // Mid/side: everything up to the output limiter runs on M (channel 0) and S (channel 1)
+    const bool msActive = midSideEnabled && numChannels == 2;
+    if (msActive)
+        encodeMidSide(buffer, numSamples);
+
+    // MIDI events are applied at their exact sample inside the per-sample loop, so
+    // triggers don't depend on the host block size
+    const juce::MidiBuffer& midiEvents = (midi != nullptr) ? *midi : noMidi;
+    auto midiEvent = midiEvents.findNextSamplePosition(midiOffset);
+
+    // Modulation routing is recompiled only when a slot or macro target changed
+    if (modRoutingDirty)
+        compileModRouting();
+    updateStaticModulation();
+    updateSnapshots(numSamples);
+    renderSequencer(numSamples);
+    updateResonanceCompensation(numSamples);
+    updateUnisonRamp(numSamples);
+    const auto midiEnd = midiEvents.cend();
 
     for (int sample = 0; sample < numSamples; ++sample)
     {
-        // Get mono input for modulation sources
-        float monoInput = 0.0f;
-        for (int ch = 0; ch < numChannels; ++ch)
-            monoInput += buffer.getSample(ch, sample);
-        monoInput /= static_cast<float>(juce::jmax(1, numChannels));
+        for (; midiEvent != midiEnd && (*midiEvent).samplePosition - midiOffset <= sample; ++midiEvent)
+            handleMidiMessage((*midiEvent).getMessage());
+
+        // Analog drift: each channel draws its next offsets at control rate
+        const bool driftActive = driftAmount > 0.0f;
+        if (driftActive && --driftCountdown <= 0)
+        {
+            for (int ch = 0; ch < numChannels; ++ch)
+                channelStates[static_cast<size_t>(ch)].drift.update(driftAmount, driftWalkDecay, driftWalkNoise);
+            driftCountdown = DRIFT_INTERVAL;
+        }
+
+        // Stepped snapshots change on the grid line, not the block boundary
+        if (sample == snapshotSwitchSample && snapshotSwitchIndex != activeSnapshot)
+            startSnapshotFade(snapshotSwitchIndex, 1.0f / juce::jmax(1.0f, snapshotFadeMs * 0.001f * static_cast<float>(sampleRate)));
+        if (snapshotFade < 1.0f)
+            advanceSnapshotFade();
 
         // Input envelope for ADSR triggering
-        float inputLevel = inputEnvFollower.process(std::abs(monoInput * inputGain));
+        float inputLevel = detectorLevels[static_cast<size_t>(sample)];
 
-        // Trigger ADSR based on input level crossing threshold
+        // Sidechain audio for FM, delayed with the main path
+        float sidechainSample = sidechainMono[static_cast<size_t>(sample)];
+        if (lookaheadSamples > 0)
+            sidechainSample = sidechainLookahead.process(sidechainSample);
+
+        // Trigger ADSR based on input level crossing threshold (a held MIDI note keeps it open)
         float threshold = 0.1f * (1.0f - envSensitivity) + 0.01f;
-        if (inputLevel > threshold && lastInputLevel <= threshold && !envTriggered)
-        {
-            adsrEnv.trigger();
-            envTriggered = true;
-        }
-        else if (inputLevel < threshold * 0.5f && envTriggered)
+        if (envTrigger != EnvTrigger::MIDI)
         {
-            adsrEnv.release();
-            envTriggered = false;
+            if (inputLevel > threshold && lastInputLevel <= threshold && !envTriggered)
+            {
+                adsrEnv.trigger();
+                envTriggered = true;
+            }
+            else if (inputLevel < threshold * 0.5f && envTriggered)
+            {
+                if (envTrigger == EnvTrigger::Audio || heldNotes.none())
+                    adsrEnv.release();
+                envTriggered = false;
+            }
         }
         lastInputLevel = inputLevel;
 
         // === Compute all modulation sources ===
         float envValue = adsrEnv.process();
-        float lfo1Value = lfo.process();
-        float lfo2Value = lfo2.process();
+        // LFOs render LFO_BLOCK_SIZE samples ahead; rate modulation is picked up per block
+        if (lfoBlockPos >= lfoBlockLength)
+        {
+            lfoBlockLength = juce::jmin(LFO_BLOCK_SIZE, numSamples - sample);
+            lfo.render(lfo1Block.data(), lfoBlockLength, lfo1RateMod);
+            lfo2.render(lfo2Block.data(), lfoBlockLength, lfo2RateMod);
+            lfoBlockPos = 0;
+        }
+        float lfo1Value = lfo1Block[static_cast<size_t>(lfoBlockPos)];
+        float lfo2Value = lfo2Block[static_cast<size_t>(lfoBlockPos)];
+        ++lfoBlockPos;
 
-        // === Calculate legacy modulation (backward compatible) ===
-        float envMod = envValue * envAmount * 8000.0f;
-        float lfoMod = lfo1Value * lfoDepth * 2000.0f;
+        const float freqModScale = expFreqMod ? 5.0f : 8000.0f;
 
         // === Modulation Matrix Processing ===
-        float modFilter1Freq = 0.0f;
-        float modFilter1Reso = 0.0f;
-        float modFilter2Freq = 0.0f;
-        float modFilter2Reso = 0.0f;
-        float modFMAmount = 0.0f;
-        float modDriveAmount = 0.0f;
-        float modLFO1Rate = 0.0f;
-        float modLFO2Rate = 0.0f;
-        float modMix = 0.0f;
-        float modAMAmount = 0.0f;
-
-        for (int slot = 0; slot < NUM_MOD_SLOTS; ++slot)
+        // One pass over the compiled routing table, in dependency order; macro targets are
+        // already summed into staticModulation (macro source values are set per block)
+        modSourceValues[static_cast<size_t>(ModSource::LFO1)] = lfo1Value;
+        modSourceValues[static_cast<size_t>(ModSource::LFO2)] = lfo2Value;
+        modSourceValues[static_cast<size_t>(ModSource::Envelope)] = envValue * 2.0f - 1.0f;  // Convert 0-1 to -1 to 1
+        modSourceValues[static_cast<size_t>(ModSource::InputFollower)] = inputLevel * 2.0f - 1.0f;
+        modSourceValues[static_cast<size_t>(ModSource::Velocity)] = noteVelocity * 2.0f - 1.0f;
+        if (sequencerRouted)
+            modSourceValues[static_cast<size_t>(ModSource::Sequencer)] = sequencerBlock[static_cast<size_t>(sample)];
+        if (spectralRouted)
         {
-            const auto& modSlot = modSlots[slot];
-            if (modSlot.source == ModSource::None || modSlot.destination == ModDestination::None)
-                continue;
-
-            // Get source value (-1 to 1)
-            float sourceValue = 0.0f;
-            switch (modSlot.source)
-            {
-                case ModSource::LFO1:
-                    sourceValue = lfo1Value;
-                    break;
-                case ModSource::LFO2:
-                    sourceValue = lfo2Value;
-                    break;
-                case ModSource::Envelope:
-                    sourceValue = envValue * 2.0f - 1.0f;  // Convert 0-1 to -1 to 1
-                    break;
-                case ModSource::InputFollower:
-                    sourceValue = inputLevel * 2.0f - 1.0f;
-                    break;
-                default:
-                    break;
-            }
+            for (int output = 0; output < SpectralFollower::NUM_OUTPUTS; ++output)
+                modSourceValues[static_cast<size_t>(ModSource::InputLow) + static_cast<size_t>(output)] =
+                    spectralFollower.getOutput(output, sample);
+        }
 
-            // Apply amount (source * amount gives modulation value)
-            float modValue = sourceValue * modSlot.amount;
+        std::array<float, NUM_MOD_DESTINATIONS> modulation = staticModulation;
+        evaluateModRoutes(*modRouting, modulation, carriedModulation);
 
-            // Accumulate to destination
-            switch (modSlot.destination)
-            {
-                case ModDestination::Filter1Freq:
-                    modFilter1Freq += modValue * 8000.0f;
-                    break;
-                case ModDestination::Filter1Reso:
-                    modFilter1Reso += modValue * 0.5f;
-                    break;
-                case ModDestination::Filter2Freq:
-                    modFilter2Freq += modValue * 8000.0f;
-                    break;
-                case ModDestination::Filter2Reso:
-                    modFilter2Reso += modValue * 0.5f;
-                    break;
-                case ModDestination::FMAmount:
-                    modFMAmount += modValue;
-                    break;
-                case ModDestination::DriveAmount:
-                    modDriveAmount += modValue;
-                    break;
-                case ModDestination::LFO1Rate:
-                    modLFO1Rate += modValue * 10.0f;
-                    break;
-                case ModDestination::LFO2Rate:
-                    modLFO2Rate += modValue * 10.0f;
-                    break;
-                case ModDestination::Mix:
-                    modMix += modValue;
-                    break;
-                case ModDestination::AMAmount:
-                    modAMAmount += modValue;
-                    break;
-                default:
-                    break;
-            }
+        // During a snapshot crossfade the outgoing table runs too and the two are blended
+        if (fadeFromRouting != nullptr && fadeFromRouting != modRouting)
+        {
+            std::array<float, NUM_MOD_DESTINATIONS> fadeModulation = staticModulation;
+            std::array<float, NUM_MOD_DESTINATIONS> fadeCarried = {};
+            evaluateModRoutes(*fadeFromRouting, fadeModulation, fadeCarried);
+            for (size_t dest = 0; dest < modulation.size(); ++dest)
+                modulation[dest] += (fadeModulation[dest] - modulation[dest]) * (1.0f - snapshotFade);
         }
 
-        // Apply LFO rate modulation if needed
-        if (modLFO1Rate != 0.0f)
-            lfo.setRate(juce::jlimit(0.01f, 20.0f, lfoBaseRate + modLFO1Rate), sampleRate);
-        if (modLFO2Rate != 0.0f)
-            lfo2.setRate(juce::jlimit(0.01f, 20.0f, lfo2BaseRate + modLFO2Rate), sampleRate);
+        auto modValue = [&modulation](ModDestination dest) { return modulation[static_cast<size_t>(dest)]; };
+
+        // === Legacy modulation (Hz in linear mode, octaves in exponential mode) ===
+        // In poly mode each voice applies its own envelope instead (see updatePolyCutoffs)
+        const float modulatedEnvAmount = juce::jlimit(-1.0f, 1.0f, sound.envAmount + modValue(ModDestination::EnvAmount));
+        const float modulatedLFODepth = juce::jlimit(0.0f, 1.0f, sound.lfoDepth + modValue(ModDestination::LFO1Depth));
+        float envMod = polyMode ? 0.0f : envValue * modulatedEnvAmount * (expFreqMod ? 5.0f : 8000.0f);
+        float lfoMod = lfo1Value * modulatedLFODepth * (expFreqMod ? 2.0f : 2000.0f);
+
+        float modFilter1Freq = modValue(ModDestination::Filter1Freq) * freqModScale;
+        float modFilter1Reso = modValue(ModDestination::Filter1Reso) * 0.5f;
+        float modFilter2Freq = modValue(ModDestination::Filter2Freq) * freqModScale;
+        float modFilter2Reso = modValue(ModDestination::Filter2Reso) * 0.5f;
+        float modFMAmount = modValue(ModDestination::FMAmount);
+        float modDriveAmount = modValue(ModDestination::DriveAmount);
+        float modLFO1Rate = modValue(ModDestination::LFO1Rate) * 10.0f;
+        float modLFO2Rate = modValue(ModDestination::LFO2Rate) * 10.0f;
+        float modMix = modValue(ModDestination::Mix);
+        float modAMAmount = modValue(ModDestination::AMAmount);
+        float modFilter1Type = modValue(ModDestination::Filter1Type) * static_cast<float>(NUM_FILTER_TYPES - 1);
+        float modFilter2Type = modValue(ModDestination::Filter2Type) * static_cast<float>(NUM_FILTER_TYPES - 1);
+        float modFilter1Morph = modValue(ModDestination::Filter1Morph) * 3.0f;  // Full LP -> Notch sweep
+        float modFilter2Morph = modValue(ModDestination::Filter2Morph) * 3.0f;
+
+        // LFO rate modulation applies from the next rendered LFO block
+        lfo1RateMod = modLFO1Rate;
+        lfo2RateMod = modLFO2Rate;
 
         // Calculate modulated parameter values
-        float modulatedFM = juce::jlimit(0.0f, 1.0f, fmAmount + modFMAmount);
-        float modulatedDrive = juce::jlimit(0.0f, 1.0f, driveAmount + modDriveAmount);
-        float modulatedMix = juce::jlimit(0.0f, 1.0f, dryWetMix + modMix);
-        float modulatedAM = juce::jlimit(0.0f, 1.0f, amAmount + modAMAmount);
+        float modulatedFM = juce::jlimit(0.0f, 1.0f, sound.fmAmount + modFMAmount);
+        float modulatedDrive = juce::jlimit(0.0f, 1.0f, sound.driveAmount + modDriveAmount);
+        float modulatedMix = juce::jlimit(0.0f, 1.0f, sound.dryWetMix + modMix);
+        float modulatedAM = juce::jlimit(0.0f, 1.0f, sound.amAmount + modAMAmount);
+
+        // Filter type (automation and modulation both go through the crossfade)
+        auto modulatedType = [](FilterType base, float offset)
+        {
+            int index = static_cast<int>(base) + static_cast<int>(std::round(offset));
+            return static_cast<FilterType>(juce::jlimit(0, NUM_FILTER_TYPES - 1, index));
+        };
+        requestFilterType(0, filter1Fade, modulatedType(sound.filter1Type, modFilter1Type));
+        requestFilterType(1, filter2Fade, modulatedType(sound.filter2Type, modFilter2Type));
+
+        // Output morph (mode selects a fixed tap, Morph mode sweeps them continuously)
+        float f1Morph = juce::jlimit(0.0f, 3.0f, sound.filter1Morph + modFilter1Morph);
+        float f2Morph = juce::jlimit(0.0f, 3.0f, sound.filter2Morph + modFilter2Morph);
+
+        // Apply modulation to filter frequencies (legacy + matrix), shared by all channels
+        float f1FreqMod = modFilter1Freq + envMod;
+        float f2FreqMod = modFilter2Freq + envMod;
+        if (lfoTarget == 0 || lfoTarget == 2)
+            f1FreqMod += lfoMod;
+        if (lfoTarget == 1 || lfoTarget == 2)
+            f2FreqMod += lfoMod;
+
+        // Exponential mode sums in octaves, so sweeps are even around the base cutoff
+        float f1Freq = expFreqMod ? sound.filter1Freq * fastExp2(f1FreqMod) : sound.filter1Freq + f1FreqMod;
+        float f2Freq = expFreqMod ? sound.filter2Freq * fastExp2(f2FreqMod) : sound.filter2Freq + f2FreqMod;
+        float f1Reso = sound.filter1Reso + modFilter1Reso;
+        float f2Reso = sound.filter2Reso + modFilter2Reso;
+
+        // Clamp values
+        f1Freq = juce::jlimit(20.0f, 20000.0f, f1Freq);
+        f2Freq = juce::jlimit(20.0f, 20000.0f, f2Freq);
+        f1Reso = juce::jlimit(0.0f, 1.0f, f1Reso);
+        f2Reso = juce::jlimit(0.0f, 1.0f, f2Reso);
+
+        if (polyMode)
+        {
+            polyVoices.advance(adsrEnv);
+            updatePolyCutoffs(modulatedEnvAmount);
+        }
+
+        // Stereo spread: LFO1 pushes alternate channels' cutoffs apart (up to +/-2 octaves)
+        const float spreadOctaves = (numChannels > 1) ? lfo1Value * stereoSpread * 2.0f : 0.0f;
+
+        // Gather the channel frame: the input EQ runs every channel in one lane-parallel pass
+        float inputFrame[MAX_CHANNELS] = {};
+        float dryFrame[MAX_CHANNELS] = {};
 
         for (int ch = 0; ch < numChannels; ++ch)
         {
+            auto& state = channelStates[static_cast<size_t>(ch)];
             float input = buffer.getSample(ch, sample);
+
+            // Lookahead: audio (wet and dry) is delayed so the envelope opens on the transient
+            if (lookaheadSamples > 0)
+                input = state.lookahead.process(input);
+
             float drySignal = input;
+            if (limiterEnabled)
+                drySignal = state.limiterDry.process(drySignal);
+
+            dryFrame[ch] = drySignal;
+            inputFrame[ch] = state.excluded ? 0.0f : input * inputGain;
+        }
+
+        // Input EQ (plus HI BOOST / HI CUT shelves)
+        inputEQ.processFrame(inputFrame, numEQLanes);
+
+        for (int ch = 0; ch < numChannels; ++ch)
+        {
+            auto& state = channelStates[static_cast<size_t>(ch)];
+            float input = inputFrame[ch];
+            const float drySignal = dryFrame[ch];
 
-            // Input gain
-            input *= inputGain;
+            if (float* dryOutput = dryOutputs[static_cast<size_t>(ch)])
+                dryOutput[sample] = drySignal;
+
+            // Excluded channels (centre/LFE) pass through; the output pass keeps them aligned
+            if (state.excluded)
+            {
+                buffer.setSample(ch, sample, drySignal);
+                continue;
+            }
 
-            // Input section processing
-            if (hiBoostEnabled)
-                input = (ch == 0) ? hiBoostL.process(input) : hiBoostR.process(input);
-            if (hiCutEnabled)
-                input = (ch == 0) ? hiCutL.process(input) : hiCutR.process(input);
             if (limiterEnabled)
-                input = softLimit(input);
+                input = state.inputLimiter.process(input);
 
-            // Pre-filter drive (with modulation)
-            if (!drivePost && modulatedDrive > 0.0f)
+            // This channel's drift, ramped between control-rate draws
+            float channelDrive = modulatedDrive;
+            if (driftActive)
             {
-                float savedDrive = driveAmount;
-                driveAmount = modulatedDrive;
-                input = processDrive(input);
-                driveAmount = savedDrive;
+                state.drift.advance();
+                channelDrive = juce::jlimit(0.0f, 1.0f, modulatedDrive * (1.0f + state.drift.value[AnalogDrift::Drive]));
             }
 
+            // Pre-filter drive (with modulation)
+            if (!drivePost && channelDrive > 0.0f)
+                input = processDrive(input, channelDrive, state.preDrive);
+
             // Get the appropriate filter instances
-            SVFilter& f1 = (ch == 0) ? filter1L : filter1R;
-            SVFilter& f2 = (ch == 0) ? filter2L : filter2R;
-
-            // Apply modulation to filter frequencies (legacy + matrix)
-            float f1Freq = filter1BaseFreq + modFilter1Freq;
-            float f2Freq = filter2BaseFreq + modFilter2Freq;
-            float f1Reso = filter1BaseReso + modFilter1Reso;
-            float f2Reso = filter2BaseReso + modFilter2Reso;
-
-            // Add legacy LFO modulation
-            if (lfoTarget == 0 || lfoTarget == 2)
-                f1Freq += lfoMod;
-            if (lfoTarget == 1 || lfoTarget == 2)
-                f2Freq += lfoMod;
-
-            // Add legacy envelope modulation
-            f1Freq += envMod;
-            f2Freq += envMod;
-
-            // Clamp values
-            f1Freq = juce::jlimit(20.0f, 20000.0f, f1Freq);
-            f2Freq = juce::jlimit(20.0f, 20000.0f, f2Freq);
-            f1Reso = juce::jlimit(0.0f, 1.0f, f1Reso);
-            f2Reso = juce::jlimit(0.0f, 1.0f, f2Reso);
-
-            float output1, output2;
-
-            if (parallelRouting)
+            SVFilter& f1 = state.filters[0];
+            SVFilter& f2 = state.filters[1];
+            f1.setMorphPosition(f1Morph);
+            f2.setMorphPosition(f2Morph);
+
+            // Per-channel offsets on top of the shared modulation: stereo spread and drift,
+            // plus the side channel's own offsets in unlinked M/S mode
+            float channelOctaves = (ch & 1) ? -spreadOctaves : spreadOctaves;
+            float channelReso = 0.0f;
+            if (driftActive)
+            {
+                channelOctaves += state.drift.value[AnalogDrift::Cutoff];
+                channelReso += state.drift.value[AnalogDrift::Resonance];
+            }
+            if (ch == 1 && msActive && !sideLinked)
+            {
+                channelOctaves += sideFreqOffset;
+                channelReso += sideResoOffset;
+            }
+
+            const float channelScale = (channelOctaves != 0.0f) ? fastExp2(channelOctaves) : 1.0f;
+            const float ch1Freq = juce::jlimit(20.0f, 20000.0f, f1Freq * channelScale);
+            const float ch2Freq = juce::jlimit(20.0f, 20000.0f, f2Freq * channelScale);
+            const float ch1Reso = juce::jlimit(0.0f, 1.0f, f1Reso + channelReso);
+            const float ch2Reso = juce::jlimit(0.0f, 1.0f, f2Reso + channelReso);
+
+            // Cross-modulation from the previous sample's filter outputs
+            float ch1ModFreq = ch1Freq;
+            float ch2ModFreq = ch2Freq;
+            if (crossModActive)
             {
-                // Parallel: both filters process input independently
-                f1.frequency = f1Freq;
-                f1.resonance = f1Reso;
-                f1.updateCoefficients(sampleRate);
-                output1 = f1.process(input);
-
-                // FM modulation: Filter 1 output modulates Filter 2 frequency
-                float fmMod = output1 * modulatedFM * 4000.0f;
-                f2.frequency = juce::jlimit(20.0f, 20000.0f, f2Freq + fmMod);
-                f2.resonance = f2Reso;
-                f2.updateCoefficients(sampleRate);
-                output2 = f2.process(input);
-
-                // Mix parallel outputs
-                input = (output1 + output2) * 0.5f;
+                ch1ModFreq = applyCrossMod(ch1ModFreq, state.lastOutput[1], CrossModPath::Filter2ToFilter1);
+                ch1ModFreq = applyCrossMod(ch1ModFreq, state.lastOutput[0], CrossModPath::SelfFM);
+                ch2ModFreq = applyCrossMod(ch2ModFreq, state.lastOutput[1], CrossModPath::SelfFM);
             }
-            else
+
+            // Filters, wired by the compiled routing kernel
+            const FilterFrame frame{{ch1ModFreq, ch2ModFreq}, {ch1Reso, ch2Reso}, modulatedFM, sidechainSample};
+            const RoutedSample routed = (this->*routingKernel)(state, ch, input, frame);
+            input = routed.output;
+            state.lastOutput[0] = std::isfinite(routed.filter1) ? routed.filter1 : 0.0f;
+            state.lastOutput[1] = std::isfinite(routed.filter2) ? routed.filter2 : 0.0f;
+
+            if (tapOutputsActive)
             {
-                // Series: Filter 1 -> Filter 2
-                f1.frequency = f1Freq;
-                f1.resonance = f1Reso;
-                f1.updateCoefficients(sampleRate);
-                output1 = f1.process(input);
-
-                // FM modulation
-                float fmMod = output1 * modulatedFM * 4000.0f;
-                f2.frequency = juce::jlimit(20.0f, 20000.0f, f2Freq + fmMod);
-                f2.resonance = f2Reso;
-                f2.updateCoefficients(sampleRate);
-                output2 = f2.process(output1);
-
-                input = output2;
+                writeTaps(f1, routed.filter1, tapOutputs[0][static_cast<size_t>(ch)], sample);
+                writeTaps(f2, routed.filter2, tapOutputs[1][static_cast<size_t>(ch)], sample);
             }
 
             // AM modulation (with matrix modulation)
             if (modulatedAM > 0.0f)
             {
-                float amEnv = amEnvFollower.process(std::abs(output2));
+                float amEnv = state.amFollower.process(std::abs(routed.amSource));
                 float amGain = 1.0f - (modulatedAM * (1.0f - amEnv));
                 input *= amGain;
             }
 
             // Post-filter drive (with modulation)
-            if (drivePost && modulatedDrive > 0.0f)
-            {
-                float savedDrive = driveAmount;
-                driveAmount = modulatedDrive;
-                input = processDrive(input);
-                driveAmount = savedDrive;
-            }
+            if (drivePost && channelDrive > 0.0f)
+                input = processDrive(input, channelDrive, state.postDrive);
 
             // Dry/wet mix (with modulation)
             float output = drySignal * (1.0f - modulatedMix) + input * modulatedMix;
@@ -312,289 +773,1821 @@ void DualCoreDSP::process(juce::AudioBuffer<float>& buffer)
 
             buffer.setSample(ch, sample, output);
         }
+
+        if (filter1Fade.isActive())
+            advanceTypeCrossfade(0, filter1Fade);
+        if (filter2Fade.isActive())
+            advanceTypeCrossfade(1, filter2Fade);
+
+        resoCompGain[0] += resoCompStep[0];
+        resoCompGain[1] += resoCompStep[1];
+        if (unisonRamping)
+            advanceUnisonRamp();
+    }
+
+    if (msActive)
+        decodeMidSide(buffer.getWritePointer(0), buffer.getWritePointer(1), numSamples);
+
+    // Output limiter runs on the decoded L/R signal; excluded channels get the matching delay
+    if (outputLimiterEnabled)
+    {
+        for (int ch = 0; ch < numChannels; ++ch)
+        {
+            auto& state = channelStates[static_cast<size_t>(ch)];
+            float* data = buffer.getWritePointer(ch);
+
+            for (int sample = 0; sample < numSamples; ++sample)
+                data[sample] = state.excluded ? state.bypassDelay.process(data[sample])
+                                              : state.outputLimiter.process(data[sample]);
+        }
     }
+
+    if (tapOutputsActive)
+        finishTapOutputs(numChannels, numSamples, msActive);
 }
 
-// === Parameter Setters ===
+// === Mid/Side ===
 
-void DualCoreDSP::setInputGain(float gainDb)
+void DualCoreDSP::encodeMidSide(juce::AudioBuffer<float>& buffer, int numSamples)
 {
-    inputGain = juce::Decibels::decibelsToGain(gainDb);
+    float* left = buffer.getWritePointer(0);
+    float* right = buffer.getWritePointer(1);
+    float* scratch = msScratch.data();
+
+    // M = (L + R) / 2, S = (L - R) / 2 = L - M
+    juce::FloatVectorOperations::copy(scratch, left, numSamples);
+    juce::FloatVectorOperations::add(left, right, numSamples);
+    juce::FloatVectorOperations::multiply(left, 0.5f, numSamples);
+    juce::FloatVectorOperations::subtract(right, scratch, left, numSamples);
 }
 
-void DualCoreDSP::setHiBoost(bool enabled)
+void DualCoreDSP::decodeMidSide(float* mid, float* side, int numSamples)
 {
-    hiBoostEnabled = enabled;
+    float* scratch = msScratch.data();
+
+    // L = M + S, R = M - S
+    juce::FloatVectorOperations::copy(scratch, mid, numSamples);
+    juce::FloatVectorOperations::add(mid, side, numSamples);
+    juce::FloatVectorOperations::subtract(side, scratch, side, numSamples);
 }
 
-void DualCoreDSP::setHiCut(bool enabled)
+// === Filter Type Crossfade ===
+
+void DualCoreDSP::requestFilterType(int filterIndex, TypeCrossfade& fade, FilterType type)
 {
-    hiCutEnabled = enabled;
+    const auto index = static_cast<size_t>(filterIndex);
+    fade.requestedType = type;
+
+    // A change arriving mid-fade is picked up once the current fade completes
+    if (fade.isActive() || channelStates[0].filters[index].type == type)
+        return;
+
+    // The current filters keep running (with their state) as the outgoing engines,
+    // the incoming type starts from a clean state and fades in
+    for (auto& state : channelStates)
+    {
+        auto& filter = state.filters[index];
+        state.outgoing[index] = filter;
+
+        filter.type = type;
+        filter.reset();
+        filter.updateCoefficients(sampleRate);
+
+        // Unison copies cross over the same way, as a second lane bank
+        state.unisonOutgoing[index] = state.unison[index];
+        state.unison[index].type = type;
+        state.unison[index].reset();
+        state.polyOutgoing[index] = state.poly[index];
+        state.poly[index].type = type;
+        state.poly[index].reset();
+        state.bandsOutgoing[index] = state.bands[index];
+        state.bands[index].type = type;
+        state.bands[index].reset();
+
+        // The cascade stage crossfades alongside the first stage
+        auto& stage = state.cascade[index];
+        state.cascadeOutgoing[index] = stage;
+        stage.type = type;
+        stage.reset();
+    }
+
+    fade.samplesRemaining = fade.lengthSamples;
+}
+
+void DualCoreDSP::advanceTypeCrossfade(int filterIndex, TypeCrossfade& fade)
+{
+    if (--fade.samplesRemaining == 0
+        && fade.requestedType != channelStates[0].filters[static_cast<size_t>(filterIndex)].type)
+        requestFilterType(filterIndex, fade, fade.requestedType);
+}
+
+float DualCoreDSP::processWithCrossfade(SVFilter& filter, SVFilter& outgoing, const TypeCrossfade& fade, float input)
+{
+    float output = filter.process(input);
+
+    if (!fade.isActive())
+        return output;
+
+    // Outgoing filter tracks the same modulated cutoff/resonance/morph during the fade
+    outgoing.frequency = filter.frequency;
+    outgoing.resonance = filter.resonance;
+    outgoing.setMorphPosition(filter.morphPosition);
+    outgoing.updateCoefficients(sampleRate);
+
+    // Both engines see the same input, so a linear (correlated) crossfade keeps level constant
+    float incoming = fade.getIncomingGain();
+    float outgoingOutput = outgoing.process(input);
+
+    // Blend the taps as well so multi-output destinations stay click-free
+    auto blend = [incoming](float from, float to) { return from + (to - from) * incoming; };
+    filter.taps.lowpass = blend(outgoing.taps.lowpass, filter.taps.lowpass);
+    filter.taps.bandpass = blend(outgoing.taps.bandpass, filter.taps.bandpass);
+    filter.taps.highpass = blend(outgoing.taps.highpass, filter.taps.highpass);
+    filter.taps.notch = blend(outgoing.taps.notch, filter.taps.notch);
+
+    return blend(outgoingOutput, output);
+}
+
+void DualCoreDSP::processLanesWithCrossfade(FilterLanes& lanes, FilterLanes& outgoing, const TypeCrossfade& fade,
+                                            const float* input)
+{
+    lanes.process(input);
+
+    if (!fade.isActive())
+        return;
+
+    // Lane version of processWithCrossfade: the outgoing bank tracks the same settings
+    constexpr int numLanes = FilterLanes::LANES;
+    std::copy(std::begin(lanes.frequency), std::end(lanes.frequency), std::begin(outgoing.frequency));
+    std::copy(std::begin(lanes.resonance), std::end(lanes.resonance), std::begin(outgoing.resonance));
+    std::copy(std::begin(lanes.tapGains), std::end(lanes.tapGains), std::begin(outgoing.tapGains));
+    outgoing.updateCoefficients(sampleRate);
+    outgoing.process(input);
+
+    const float incoming = fade.getIncomingGain();
+    for (int lane = 0; lane < numLanes; ++lane)
+    {
+        lanes.output[lane] = outgoing.output[lane] + (lanes.output[lane] - outgoing.output[lane]) * incoming;
+        lanes.tapLowpass[lane] = outgoing.tapLowpass[lane] + (lanes.tapLowpass[lane] - outgoing.tapLowpass[lane]) * incoming;
+        lanes.tapBandpass[lane] = outgoing.tapBandpass[lane] + (lanes.tapBandpass[lane] - outgoing.tapBandpass[lane]) * incoming;
+        lanes.tapHighpass[lane] = outgoing.tapHighpass[lane] + (lanes.tapHighpass[lane] - outgoing.tapHighpass[lane]) * incoming;
+        lanes.tapNotch[lane] = outgoing.tapNotch[lane] + (lanes.tapNotch[lane] - outgoing.tapNotch[lane]) * incoming;
+    }
+}
+
+// === Unison ===
+
+float DualCoreDSP::processUnison(FilterLanes& lanes, FilterLanes& outgoing, SVFilter& filter, const TypeCrossfade& fade,
+                                 float input, float voiceOutput)
+{
+    constexpr int numLanes = FilterLanes::LANES;
+
+    // Extra voices follow the fully modulated cutoff/resonance of voice 0
+    for (int lane = 0; lane < numLanes; ++lane)
+    {
+        lanes.frequency[lane] = juce::jlimit(20.0f, 20000.0f, filter.frequency * unisonLayout.scale[lane]);
+        lanes.resonance[lane] = juce::jlimit(0.0f, 1.0f, filter.resonance + unisonLayout.resoOffset[lane]);
+    }
+    lanes.updateCoefficients(sampleRate);
+    std::copy(std::begin(filter.tapGains), std::end(filter.tapGains), std::begin(lanes.tapGains));
+
+    alignas(32) float inputs[numLanes];
+    std::fill(std::begin(inputs), std::end(inputs), std::isfinite(input) ? input : 0.0f);
+    processLanesWithCrossfade(lanes, outgoing, fade, inputs);
+
+    // Unused lanes have zero gain, so the reduction needs no branches
+    const float* laneGain = unisonLayout.laneGain;
+    float sum = 0.0f, lowpass = 0.0f, bandpass = 0.0f, highpass = 0.0f, notch = 0.0f;
+    for (int lane = 0; lane < numLanes; ++lane)
+    {
+        sum += lanes.output[lane] * laneGain[lane];
+        lowpass += lanes.tapLowpass[lane] * laneGain[lane];
+        bandpass += lanes.tapBandpass[lane] * laneGain[lane];
+        highpass += lanes.tapHighpass[lane] * laneGain[lane];
+        notch += lanes.tapNotch[lane] * laneGain[lane];
+    }
+
+    // Voice 0 and the copies are both crossfaded already; the normalisation only moves
+    // with the voice count, ramped with the lane gains
+    const float norm = unisonLayout.norm;
+    filter.taps.lowpass = (filter.taps.lowpass + lowpass) * norm;
+    filter.taps.bandpass = (filter.taps.bandpass + bandpass) * norm;
+    filter.taps.highpass = (filter.taps.highpass + highpass) * norm;
+    filter.taps.notch = (filter.taps.notch + notch) * norm;
+
+    return (voiceOutput + sum) * norm;
+}
+
+// FM modulation: Filter 1 output or the sidechain modulates Filter 2 frequency (+/-4000 Hz or +/-2 octaves)
+float DualCoreDSP::applyFM(float baseFreq, float filter1Output, float amount, float sidechainSample) const
+{
+    float fmSignal = (fmSource == FMSource::Sidechain) ? sidechainSample : filter1Output;
+    float fmMod = fmSignal * amount;
+    float freq = expFreqMod ? baseFreq * fastExp2(fmMod * 2.0f) : baseFreq + fmMod * 4000.0f;
+    return juce::jlimit(20.0f, 20000.0f, freq);
+}
+
+float DualCoreDSP::applyCrossMod(float baseFreq, float modulator, CrossModPath path) const
+{
+    const auto index = static_cast<size_t>(path);
+    float mod = modulator * crossModAmount[index];
+    if (mod == 0.0f)
+        return baseFreq;
+
+    // Same depth scales as the FM section: +/-2 octaves or +/-4 kHz at full
+    float freq = crossModExp[index] ? baseFreq * fastExp2(mod * 2.0f) : baseFreq + mod * 4000.0f;
+    return juce::jlimit(20.0f, 20000.0f, freq);
 }
 
-void DualCoreDSP::setLimiterEnabled(bool enabled)
+// === Resonance Compensation ===
+
+float DualCoreDSP::getResonanceCompensation(FilterType type, float resonance)
+{
+    const auto& row = resoCompTableDb[juce::jlimit(0, NUM_FILTER_TYPES - 1, static_cast<int>(type))];
+    const float position = juce::jlimit(0.0f, 1.0f, resonance) * static_cast<float>(RESO_COMP_POINTS - 1);
+    const int index = juce::jmin(static_cast<int>(position), RESO_COMP_POINTS - 2);
+    const float frac = position - static_cast<float>(index);
+    return juce::Decibels::decibelsToGain(row[index] + (row[index + 1] - row[index]) * frac);
+}
+
+void DualCoreDSP::updateResonanceCompensation(int numSamples)
+{
+    // The target follows the block's resonance (panel, snapshots and macros) and the running
+    // filter type; per-sample resonance modulation is deliberately not tracked. Every block
+    // starts exactly on the previous target, so a settled or disabled gain is exactly 1
+    const float resonance[2] = {
+        sound.filter1Reso + staticModulation[static_cast<size_t>(ModDestination::Filter1Reso)] * 0.5f,
+        sound.filter2Reso + staticModulation[static_cast<size_t>(ModDestination::Filter2Reso)] * 0.5f};
+
+    for (size_t index = 0; index < 2; ++index)
+    {
+        resoCompGain[index] = resoCompTarget[index];
+        resoCompTarget[index] = resoCompEnabled
+            ? getResonanceCompensation(channelStates[0].filters[index].type, resonance[index])
+            : 1.0f;
+        resoCompStep[index] = (resoCompTarget[index] - resoCompGain[index]) / static_cast<float>(juce::jmax(1, numSamples));
+    }
+}
+
+float DualCoreDSP::applyResonanceCompensation(SVFilter& filter, int filterIndex, float output) const
+{
+    // Taps too, so the aux outputs match the main path
+    const float gain = resoCompGain[static_cast<size_t>(filterIndex)];
+    filter.taps.lowpass *= gain;
+    filter.taps.bandpass *= gain;
+    filter.taps.highpass *= gain;
+    filter.taps.notch *= gain;
+    return output * gain;
+}
+
+void DualCoreDSP::applyResonanceCompensation(FilterLanes& lanes, int filterIndex) const
+{
+    const float gain = resoCompGain[static_cast<size_t>(filterIndex)];
+    for (int lane = 0; lane < FilterLanes::LANES; ++lane)
+    {
+        lanes.output[lane] *= gain;
+        lanes.tapLowpass[lane] *= gain;
+        lanes.tapBandpass[lane] *= gain;
+        lanes.tapHighpass[lane] *= gain;
+        lanes.tapNotch[lane] *= gain;
+    }
+}
+
+// === Routing ===
+
+void DualCoreDSP::compileRouting()
+{
+    // Poly voices wire their own filter pairs (series, or parallel with balance)
+    if (polyMode)
+    {
+        routingKernel = &DualCoreDSP::routePoly;
+        return;
+    }
+
+    // Multiband runs a filter pair per band (series, or parallel with balance)
+    if (numBands > 1)
+    {
+        routingKernel = &DualCoreDSP::routeMultiband;
+        return;
+    }
+
+    switch (filterRouting)
+    {
+        case FilterRouting::Series:   routingKernel = &DualCoreDSP::routeSeries; break;
+        case FilterRouting::Parallel: routingKernel = &DualCoreDSP::routeParallel; break;
+        case FilterRouting::Split:    routingKernel = &DualCoreDSP::routeSplit; break;
+        case FilterRouting::Feedback: routingKernel = &DualCoreDSP::routeFeedback; break;
+        case FilterRouting::Cascade:  routingKernel = &DualCoreDSP::routeCascade; break;
+        default: routingKernel = &DualCoreDSP::routeSeries; break;
+    }
+}
+
+float DualCoreDSP::runFilter(ChannelState& state, int filterIndex, float freqHz, float resonance, float input)
+{
+    const auto index = static_cast<size_t>(filterIndex);
+    const TypeCrossfade& fade = (filterIndex == 0) ? filter1Fade : filter2Fade;
+    SVFilter& filter = state.filters[index];
+
+    filter.frequency = freqHz;
+    filter.resonance = resonance;
+    filter.updateCoefficients(sampleRate);
+    float output = processWithCrossfade(filter, state.outgoing[index], fade, input);
+
+    if (unisonVoices > 1 || unisonRamping)
+        output = processUnison(state.unison[index], state.unisonOutgoing[index], filter, fade, input, output);
+
+    return applyResonanceCompensation(filter, filterIndex, output);
+}
+
+float DualCoreDSP::runCascadeFilter(ChannelState& state, int filterIndex, float freqHz, float resonance, float input)
+{
+    const auto index = static_cast<size_t>(filterIndex);
+    const TypeCrossfade& fade = (filterIndex == 0) ? filter1Fade : filter2Fade;
+    SVFilter& stage = state.cascade[index];
+
+    stage.frequency = freqHz;
+    stage.resonance = resonance;
+    stage.setMorphPosition(state.filters[index].morphPosition);
+    stage.updateCoefficients(sampleRate);
+    return applyResonanceCompensation(stage, filterIndex,
+                                      processWithCrossfade(stage, state.cascadeOutgoing[index], fade, input));
+}
+
+DualCoreDSP::RoutedSample DualCoreDSP::routeSeries(ChannelState& state, int, float input, const FilterFrame& frame)
+{
+    RoutedSample result;
+    result.filter1 = runFilter(state, 0, frame.frequency[0], frame.resonance[0], input);
+
+    const float f2Freq = applyFM(frame.frequency[1], result.filter1, frame.fmAmount, frame.sidechain);
+    result.filter2 = runFilter(state, 1, f2Freq, frame.resonance[1], result.filter1);
+
+    result.output = result.amSource = result.filter2;
+    return result;
+}
+
+DualCoreDSP::RoutedSample DualCoreDSP::routeParallel(ChannelState& state, int, float input, const FilterFrame& frame)
+{
+    RoutedSample result;
+    result.filter1 = runFilter(state, 0, frame.frequency[0], frame.resonance[0], input);
+
+    const float f2Freq = applyFM(frame.frequency[1], result.filter1, frame.fmAmount, frame.sidechain);
+    result.filter2 = runFilter(state, 1, f2Freq, frame.resonance[1], input);
+
+    // Balance 0.5 is the plain average
+    result.output = result.filter1 * (1.0f - sound.routingBalance) + result.filter2 * sound.routingBalance;
+    result.amSource = result.filter2;
+    return result;
+}
+
+DualCoreDSP::RoutedSample DualCoreDSP::routeSplit(ChannelState& state, int channel, float input, const FilterFrame& frame)
+{
+    RoutedSample result;
+
+    if ((channel & 1) == 0)
+    {
+        result.filter1 = runFilter(state, 0, frame.frequency[0], frame.resonance[0], input);
+        splitFilter1Output = result.filter1;
+        result.output = result.amSource = result.filter1;
+    }
+    else
+    {
+        // FM comes from the partner channel's Filter 1, processed just before this one
+        const float f2Freq = applyFM(frame.frequency[1], splitFilter1Output, frame.fmAmount, frame.sidechain);
+        result.filter2 = runFilter(state, 1, f2Freq, frame.resonance[1], input);
+        result.output = result.amSource = result.filter2;
+    }
+
+    return result;
+}
+
+DualCoreDSP::RoutedSample DualCoreDSP::routeFeedback(ChannelState& state, int, float input, const FilterFrame& frame)
+{
+    RoutedSample result;
+
+    // The loop is at least one sample long: the stored sample is always from the past
+    const float feedbackInput = input + state.feedbackSample * feedbackAmount;
+    result.filter1 = runFilter(state, 0, frame.frequency[0], frame.resonance[0], feedbackInput);
+
+    const float f2Freq = applyFM(frame.frequency[1], result.filter1, frame.fmAmount, frame.sidechain);
+    result.filter2 = runFilter(state, 1, f2Freq, frame.resonance[1], result.filter1);
+
+    // Saturating the return keeps the loop bounded when the filters ring
+    state.feedbackSample = state.feedbackDelay.process(tanhApprox(result.filter2));
+
+    result.output = result.amSource = result.filter2;
+    return result;
+}
+
+DualCoreDSP::RoutedSample DualCoreDSP::routeCascade(ChannelState& state, int, float input, const FilterFrame& frame)
+{
+    RoutedSample result;
+    result.filter1 = runFilter(state, 0, frame.frequency[0], frame.resonance[0], input);
+
+    const float f2Freq = applyFM(frame.frequency[1], result.filter1, frame.fmAmount, frame.sidechain);
+    result.filter2 = runFilter(state, 1, f2Freq, frame.resonance[1], result.filter1);
+
+    // Second stage: same settings (including FM), its own state
+    const float stage1 = runCascadeFilter(state, 0, frame.frequency[0], frame.resonance[0], result.filter2);
+    const float stage2Freq = applyFM(frame.frequency[1], stage1, frame.fmAmount, frame.sidechain);
+    const float stage2 = runCascadeFilter(state, 1, stage2Freq, frame.resonance[1], stage1);
+
+    result.output = result.amSource = stage2;
+    return result;
+}
+
+DualCoreDSP::RoutedSample DualCoreDSP::routePoly(ChannelState& state, int, float input, const FilterFrame& frame)
+{
+    // Every voice runs the filter pair on this input; voices are summed by envelope
+    RoutedSample result;
+    processPolyVoices(state, input, frame.frequency[0], frame.resonance[0], frame.frequency[1], frame.resonance[1],
+                      frame.fmAmount, frame.sidechain, result.filter1, result.filter2);
+
+    result.output = (filterRouting == FilterRouting::Parallel)
+                        ? result.filter1 * (1.0f - sound.routingBalance) + result.filter2 * sound.routingBalance
+                        : result.filter2;
+    result.amSource = result.filter2;
+    return result;
+}
+
+DualCoreDSP::RoutedSample DualCoreDSP::routeMultiband(ChannelState& state, int, float input, const FilterFrame& frame)
+{
+    static_assert(MAX_BANDS <= FilterLanes::LANES, "One filter lane per band");
+    constexpr int numLanes = FilterLanes::LANES;
+
+    auto& lanes1 = state.bands[0];
+    auto& lanes2 = state.bands[1];
+    auto& f1 = state.filters[0];
+    auto& f2 = state.filters[1];
+    const bool parallel = (filterRouting == FilterRouting::Parallel);
+
+    // Unused lanes see silence, so the loop shape never depends on the band count
+    alignas(32) float bandInputs[numLanes] = {};
+    state.crossover.process(input, bandInputs);
+
+    for (int band = 0; band < numLanes; ++band)
+    {
+        lanes1.frequency[band] = juce::jlimit(20.0f, 20000.0f, frame.frequency[0] * bandCutoffScale[band]);
+        lanes1.resonance[band] = frame.resonance[0];
+    }
+    lanes1.updateCoefficients(sampleRate);
+    std::copy(std::begin(f1.tapGains), std::end(f1.tapGains), std::begin(lanes1.tapGains));
+    processLanesWithCrossfade(lanes1, state.bandsOutgoing[0], filter1Fade, bandInputs);
+    applyResonanceCompensation(lanes1, 0);
+
+    // Filter 2 per band: FM from that band's Filter 1
+    alignas(32) float inputs2[numLanes];
+    for (int band = 0; band < numLanes; ++band)
+    {
+        float freq = juce::jlimit(20.0f, 20000.0f, frame.frequency[1] * bandCutoffScale[band]);
+        lanes2.frequency[band] = applyFM(freq, lanes1.output[band], frame.fmAmount, frame.sidechain);
+        lanes2.resonance[band] = frame.resonance[1];
+        inputs2[band] = parallel ? bandInputs[band] : lanes1.output[band];
+    }
+    lanes2.updateCoefficients(sampleRate);
+    std::copy(std::begin(f2.tapGains), std::end(f2.tapGains), std::begin(lanes2.tapGains));
+    processLanesWithCrossfade(lanes2, state.bandsOutgoing[1], filter2Fade, inputs2);
+    applyResonanceCompensation(lanes2, 1);
+
+    // Per-band drive and mix, then sum. At 0% mix a band passes its crossover output
+    RoutedSample result;
+    FilterTaps taps1, taps2;
+    for (int band = 0; band < numBands; ++band)
+    {
+        float wet = parallel ? lanes1.output[band] * (1.0f - sound.routingBalance) + lanes2.output[band] * sound.routingBalance
+                             : lanes2.output[band];
+        if (bandDrive[band] > 0.0f)
+            wet = processDrive(wet, bandDrive[band], state.bandDrive[static_cast<size_t>(band)]);
+
+        result.output += bandInputs[band] + (wet - bandInputs[band]) * bandMix[band];
+        result.filter1 += lanes1.output[band];
+        result.filter2 += lanes2.output[band];
+
+        taps1.lowpass += lanes1.tapLowpass[band];
+        taps1.bandpass += lanes1.tapBandpass[band];
+        taps1.highpass += lanes1.tapHighpass[band];
+        taps1.notch += lanes1.tapNotch[band];
+        taps2.lowpass += lanes2.tapLowpass[band];
+        taps2.bandpass += lanes2.tapBandpass[band];
+        taps2.highpass += lanes2.tapHighpass[band];
+        taps2.notch += lanes2.tapNotch[band];
+    }
+
+    f1.taps = taps1;
+    f2.taps = taps2;
+    result.amSource = result.filter2;
+    return result;
+}
+
+void DualCoreDSP::updateCrossover()
+{
+    for (auto& state : channelStates)
+        state.crossover.configure(numBands, crossoverFrequencies, sampleRate);
+}
+
+// === MIDI ===
+
+void DualCoreDSP::handleMidiMessage(const juce::MidiMessage& message)
+{
+    const bool midiTriggers = envTrigger != EnvTrigger::Audio;
+
+    if (message.isNoteOn())
+    {
+        const int note = message.getNoteNumber();
+        noteVelocity = message.getFloatVelocity();
+        heldNotes.set(static_cast<size_t>(note));
+
+        if (polyMode)
+            polyVoices.noteOn(note, noteVelocity);
+
+        // Every note-on retriggers (legato lines restart the attack from the current level)
+        if (midiTriggers)
+            adsrEnv.trigger();
+
+        if (lfoRetrigger)
+        {
+            lfo.retrigger();
+            lfo2.retrigger();
+            lfoBlockPos = lfoBlockLength;  // Re-render from this sample
+        }
+    }
+    else if (message.isNoteOff())
+    {
+        const int note = message.getNoteNumber();
+        heldNotes.reset(static_cast<size_t>(note));
+
+        if (polyMode)
+            polyVoices.noteOff(note);
+
+        if (midiTriggers && heldNotes.none() && !envTriggered)
+            adsrEnv.release();
+    }
+    else if (message.isAllNotesOff() || message.isAllSoundOff())
+    {
+        heldNotes.reset();
+        polyVoices.releaseAll();
+
+        if (midiTriggers && !envTriggered)
+            adsrEnv.release();
+    }
+}
+
+// === Poly Mode ===
+
+void DualCoreDSP::updatePolyCutoffs(float modulatedEnvAmount)
+{
+    // Shared by all channels: key tracking, plus each voice's envelope in the active scale
+    const float envScale = modulatedEnvAmount * (expFreqMod ? 5.0f : 8000.0f);
+
+    for (int voice = 0; voice < MAX_POLY_VOICES; ++voice)
+    {
+        const float envMod = polyVoices.level[voice] * envScale;
+        float octaves = polyVoices.keyOctaves[voice] * keyTracking;
+        if (expFreqMod)
+            octaves += envMod;
+
+        polyCutoffScale[voice] = fastExp2(octaves);
+        polyCutoffOffset[voice] = expFreqMod ? 0.0f : envMod;
+    }
+}
+
+void DualCoreDSP::processPolyVoices(ChannelState& state, float input, float f1Freq, float f1Reso,
+                                    float f2Freq, float f2Reso, float modulatedFM, float sidechainSample,
+                                    float& output1, float& output2)
+{
+    static_assert(FilterLanes::LANES == MAX_POLY_VOICES, "One filter lane per poly voice");
+    constexpr int numVoices = MAX_POLY_VOICES;
+
+    auto& lanes1 = state.poly[0];
+    auto& lanes2 = state.poly[1];
+    auto& f1 = state.filters[0];
+    auto& f2 = state.filters[1];
+
+    // Idle voices keep running (with zero gain), so a new note never starts from stale state
+    alignas(32) float inputs[numVoices];
+    std::fill(std::begin(inputs), std::end(inputs), std::isfinite(input) ? input : 0.0f);
+
+    for (int voice = 0; voice < numVoices; ++voice)
+    {
+        lanes1.frequency[voice] = juce::jlimit(20.0f, 20000.0f, f1Freq * polyCutoffScale[voice] + polyCutoffOffset[voice]);
+        lanes1.resonance[voice] = f1Reso;
+    }
+    lanes1.updateCoefficients(sampleRate);
+    std::copy(std::begin(f1.tapGains), std::end(f1.tapGains), std::begin(lanes1.tapGains));
+    processLanesWithCrossfade(lanes1, state.polyOutgoing[0], filter1Fade, inputs);
+    applyResonanceCompensation(lanes1, 0);
+
+    // Filter 2 per voice: FM from that voice's Filter 1, series input from it too
+    for (int voice = 0; voice < numVoices; ++voice)
+    {
+        float freq = juce::jlimit(20.0f, 20000.0f, f2Freq * polyCutoffScale[voice] + polyCutoffOffset[voice]);
+        lanes2.frequency[voice] = applyFM(freq, lanes1.output[voice], modulatedFM, sidechainSample);
+        lanes2.resonance[voice] = f2Reso;
+        if (filterRouting != FilterRouting::Parallel)
+            inputs[voice] = lanes1.output[voice];
+    }
+    lanes2.updateCoefficients(sampleRate);
+    std::copy(std::begin(f2.tapGains), std::end(f2.tapGains), std::begin(lanes2.tapGains));
+    processLanesWithCrossfade(lanes2, state.polyOutgoing[1], filter2Fade, inputs);
+    applyResonanceCompensation(lanes2, 1);
+
+    // Sum the voices weighted by envelope and velocity (taps too, for the multi-outputs)
+    FilterTaps taps1, taps2;
+    output1 = output2 = 0.0f;
+    for (int voice = 0; voice < numVoices; ++voice)
+    {
+        const float gain = polyVoices.gain[voice];
+        output1 += lanes1.output[voice] * gain;
+        output2 += lanes2.output[voice] * gain;
+        taps1.lowpass += lanes1.tapLowpass[voice] * gain;
+        taps1.bandpass += lanes1.tapBandpass[voice] * gain;
+        taps1.highpass += lanes1.tapHighpass[voice] * gain;
+        taps1.notch += lanes1.tapNotch[voice] * gain;
+        taps2.lowpass += lanes2.tapLowpass[voice] * gain;
+        taps2.bandpass += lanes2.tapBandpass[voice] * gain;
+        taps2.highpass += lanes2.tapHighpass[voice] * gain;
+        taps2.notch += lanes2.tapNotch[voice] * gain;
+    }
+
+    f1.taps = taps1;
+    f2.taps = taps2;
+}
+
+// === Filter Outputs ===
+
+float DualCoreDSP::getMorphPosition(FilterMode mode, float morph)
+{
+    // Position along the LP -> BP -> HP -> Notch tap sequence
+    switch (mode)
+    {
+        case FilterMode::LowPass:  return 0.0f;
+        case FilterMode::BandPass: return 1.0f;
+        case FilterMode::HighPass: return 2.0f;
+        case FilterMode::Notch:    return 3.0f;
+        case FilterMode::Morph:    return morph * 3.0f;
+        default: return 0.0f;
+    }
+}
+
+void DualCoreDSP::writeTaps(const SVFilter& filter, float output, const TapOutputs& outputs, int sample)
+{
+    if (outputs.lowpass != nullptr)  outputs.lowpass[sample] = filter.taps.lowpass;
+    if (outputs.bandpass != nullptr) outputs.bandpass[sample] = filter.taps.bandpass;
+    if (outputs.highpass != nullptr) outputs.highpass[sample] = filter.taps.highpass;
+    if (outputs.notch != nullptr)    outputs.notch[sample] = filter.taps.notch;
+    if (outputs.filtered != nullptr) outputs.filtered[sample] = output;
+}
+
+std::array<float*, DualCoreDSP::NUM_TAP_SLOTS> DualCoreDSP::getTapDestinations(int channel) const
+{
+    const auto index = static_cast<size_t>(channel);
+    const TapOutputs& f1 = tapOutputs[0][index];
+    const TapOutputs& f2 = tapOutputs[1][index];
+
+    return {f1.lowpass, f1.bandpass, f1.highpass, f1.notch, f1.filtered,
+            f2.lowpass, f2.bandpass, f2.highpass, f2.notch, f2.filtered,
+            dryOutputs[index]};
+}
+
+void DualCoreDSP::finishTapOutputs(int numChannels, int numSamples, bool msActive)
+{
+    constexpr int drySlot = NUM_TAP_SLOTS - 1;
+
+    // Excluded channels never reach the filters; their taps are silent (dry still passes)
+    for (int ch = 0; ch < numChannels; ++ch)
+    {
+        if (!channelStates[static_cast<size_t>(ch)].excluded)
+            continue;
+
+        const auto destinations = getTapDestinations(ch);
+        for (int slot = 0; slot < drySlot; ++slot)
+            if (destinations[static_cast<size_t>(slot)] != nullptr)
+                juce::FloatVectorOperations::clear(destinations[static_cast<size_t>(slot)], numSamples);
+    }
+
+    // Taps were written in the M/S domain; decode each pair like the main bus
+    if (msActive)
+    {
+        const auto mid = getTapDestinations(0);
+        const auto side = getTapDestinations(1);
+        for (size_t slot = 0; slot < mid.size(); ++slot)
+            if (mid[slot] != nullptr && side[slot] != nullptr)
+                decodeMidSide(mid[slot], side[slot], numSamples);
+    }
+
+    // Line up with the main output, which the output limiter delays
+    if (outputLimiterEnabled)
+    {
+        for (int ch = 0; ch < numChannels; ++ch)
+        {
+            auto& state = channelStates[static_cast<size_t>(ch)];
+            const auto destinations = getTapDestinations(ch);
+
+            for (size_t slot = 0; slot < destinations.size(); ++slot)
+            {
+                float* data = destinations[slot];
+                if (data == nullptr)
+                    continue;
+
+                for (int sample = 0; sample < numSamples; ++sample)
+                    data[sample] = state.tapDelays[slot].process(data[sample]);
+            }
+        }
+    }
+}
+
+// === Parameter Setters ===
+
+void DualCoreDSP::setInputGain(float gainDb)
+{
+    inputGain = juce::Decibels::decibelsToGain(gainDb);
+}
+
+void DualCoreDSP::setHiBoost(bool enabled)
+{
+    hiBoostEnabled = enabled;
+    inputEQ.setLegacyStages(hiBoostEnabled, hiCutEnabled);
+}
+
+void DualCoreDSP::setHiCut(bool enabled)
+{
+    hiCutEnabled = enabled;
+    inputEQ.setLegacyStages(hiBoostEnabled, hiCutEnabled);
+}
+
+void DualCoreDSP::setEQBand(int band, float freqHz, float gainDb, float q)
+{
+    inputEQ.setBand(band, freqHz, gainDb, q);
+}
+
+void DualCoreDSP::setLimiterEnabled(bool enabled)
+{
+    // A limiter's delays stand still while it is off, so they are cleared when it comes back
+    inputLimiterResetPending = inputLimiterResetPending || (enabled && !limiterEnabled);
+    limiterEnabled = enabled;
+}
+
+void DualCoreDSP::setOutputLimiterEnabled(bool enabled)
+{
+    outputLimiterResetPending = outputLimiterResetPending || (enabled && !outputLimiterEnabled);
+    outputLimiterEnabled = enabled;
+}
+
+void DualCoreDSP::setLimiterCeiling(float ceilingDb)
+{
+    for (auto& state : channelStates)
+    {
+        state.inputLimiter.setCeiling(ceilingDb);
+        state.outputLimiter.setCeiling(ceilingDb);
+    }
+}
+
+void DualCoreDSP::setMidSide(bool enabled)
+{
+    midSideEnabled = enabled;
+}
+
+void DualCoreDSP::setSideLink(bool linked)
+{
+    sideLinked = linked;
+}
+
+void DualCoreDSP::setSideFreqOffset(float octaves)
+{
+    sideFreqOffset = juce::jlimit(-4.0f, 4.0f, octaves);
+}
+
+void DualCoreDSP::setSideResoOffset(float offset)
+{
+    sideResoOffset = juce::jlimit(-1.0f, 1.0f, offset);
+}
+
+void DualCoreDSP::setStereoSpread(float spread)
+{
+    stereoSpread = juce::jlimit(0.0f, 1.0f, spread);
+}
+
+void DualCoreDSP::setDrift(float amount)
+{
+    driftAmount = juce::jlimit(0.0f, 1.0f, amount);
+}
+
+void DualCoreDSP::setDriftSeed(uint32_t seed)
+{
+    if (seed != driftSeed)
+    {
+        driftSeed = seed;
+        seedDrift();
+    }
+}
+
+void DualCoreDSP::seedDrift()
+{
+    for (size_t ch = 0; ch < channelStates.size(); ++ch)
+        channelStates[ch].drift.seed(driftSeed ^ (0x9e3779b9u * static_cast<uint32_t>(ch + 1)));
+    driftCountdown = 0;
+}
+
+void DualCoreDSP::setUnison(int voices, float detune, float resoSpread)
+{
+    static_assert(MAX_UNISON_VOICES - 1 <= FilterLanes::LANES, "Extra unison voices must fit in the lanes");
+
+    voices = juce::jlimit(1, MAX_UNISON_VOICES, voices);
+    detune = juce::jlimit(0.0f, 1.0f, detune);
+    resoSpread = juce::jlimit(0.0f, 1.0f, resoSpread);
+
+    if (voices == unisonVoices && detune == unisonDetune && resoSpread == unisonResoSpread)
+        return;
+
+    // The bank only holds stale state if it was skipped; otherwise every lane, used or
+    // not, has been filtering the input all along
+    const bool bankSkipped = unisonVoices == 1 && !unisonRamping;
+    if (bankSkipped)
+        for (auto& state : channelStates)
+            for (auto& lanes : state.unison)
+                lanes.reset();
+
+    unisonVoices = voices;
+    unisonDetune = detune;
+    unisonResoSpread = resoSpread;
+    unisonTarget.norm = 1.0f / static_cast<float>(voices);
+
+    // Voices alternate above/below voice 0, evenly out to +/-1 (x detune octaves)
+    const int pairs = juce::jmax(1, voices / 2);
+    for (int lane = 0; lane < FilterLanes::LANES; ++lane)
+    {
+        const int voice = lane + 1;
+        const float magnitude = static_cast<float>((voice + 1) / 2) / static_cast<float>(pairs);
+        const float position = (voice & 1) ? magnitude : -magnitude;
+        const bool active = voice < voices;
+
+        unisonTarget.scale[lane] = std::exp2(position * detune);
+        unisonTarget.resoOffset[lane] = position * resoSpread * 0.25f;
+        unisonTarget.laneGain[lane] = active ? 1.0f : 0.0f;
+    }
+
+    // Ramped to across the next block, so automating the voice count doesn't click. A bank
+    // that was skipped is silent, so its lanes can jump straight to their new positions
+    if (bankSkipped)
+    {
+        std::copy(std::begin(unisonTarget.scale), std::end(unisonTarget.scale), std::begin(unisonLayout.scale));
+        std::copy(std::begin(unisonTarget.resoOffset), std::end(unisonTarget.resoOffset), std::begin(unisonLayout.resoOffset));
+    }
+    unisonLayoutChanged = true;
+}
+
+void DualCoreDSP::updateUnisonRamp(int numSamples)
+{
+    // A finished ramp lands exactly on its target
+    if (unisonRamping)
+    {
+        unisonLayout = unisonTarget;
+        unisonRamping = false;
+    }
+    if (!unisonLayoutChanged)
+        return;
+
+    const float blockScale = 1.0f / static_cast<float>(juce::jmax(1, numSamples));
+    for (int lane = 0; lane < FilterLanes::LANES; ++lane)
+    {
+        unisonStep.scale[lane] = (unisonTarget.scale[lane] - unisonLayout.scale[lane]) * blockScale;
+        unisonStep.resoOffset[lane] = (unisonTarget.resoOffset[lane] - unisonLayout.resoOffset[lane]) * blockScale;
+        unisonStep.laneGain[lane] = (unisonTarget.laneGain[lane] - unisonLayout.laneGain[lane]) * blockScale;
+    }
+    unisonLayoutChanged = false;
+    unisonRamping = true;
+}
+
+void DualCoreDSP::advanceUnisonRamp()
+{
+    // The normalisation follows the summed gain of the voices, so a voice fading in or
+    // out never lifts the level part-way through the ramp
+    float totalGain = 1.0f;
+    for (int lane = 0; lane < FilterLanes::LANES; ++lane)
+    {
+        unisonLayout.scale[lane] += unisonStep.scale[lane];
+        unisonLayout.resoOffset[lane] += unisonStep.resoOffset[lane];
+        unisonLayout.laneGain[lane] += unisonStep.laneGain[lane];
+        totalGain += unisonLayout.laneGain[lane];
+    }
+    unisonLayout.norm = 1.0f / totalGain;
+}
+
+void DualCoreDSP::setBandCount(int bands)
+{
+    bands = juce::jlimit(1, MAX_BANDS, bands);
+    if (bands == numBands)
+        return;
+
+    // The band layout changes, so the crossover and band filters start clean
+    for (auto& state : channelStates)
+    {
+        state.crossover.reset();
+        for (auto& lanes : state.bands)
+            lanes.reset();
+    }
+
+    numBands = bands;
+    updateCrossover();
+    compileRouting();
+}
+
+void DualCoreDSP::setCrossover(int index, float freqHz)
+{
+    if (index < 0 || index >= MAX_BANDS - 1)
+        return;
+
+    auto frequencies = crossoverFrequencies;
+    frequencies[static_cast<size_t>(index)] = juce::jlimit(20.0f, 20000.0f, freqHz);
+
+    // Keep the splits ascending (at least a third of an octave apart)
+    for (size_t i = 1; i < frequencies.size(); ++i)
+        frequencies[i] = juce::jmax(frequencies[i], frequencies[i - 1] * 1.26f);
+
+    if (frequencies == crossoverFrequencies)
+        return;
+
+    crossoverFrequencies = frequencies;
+    updateCrossover();
+}
+
+void DualCoreDSP::setBand(int band, float freqOffset, float drive, float mix)
+{
+    if (band < 0 || band >= MAX_BANDS)
+        return;
+
+    const auto index = static_cast<size_t>(band);
+    bandCutoffScale[index] = std::exp2(juce::jlimit(-4.0f, 4.0f, freqOffset));
+    bandDrive[index] = juce::jlimit(0.0f, 1.0f, drive);
+    bandMix[index] = juce::jlimit(0.0f, 1.0f, mix);
+}
+
+void DualCoreDSP::setPolyMode(bool enabled)
+{
+    if (enabled == polyMode)
+        return;
+
+    // Voices start fresh each time poly mode is switched on, so no notes hang
+    polyMode = enabled;
+    compileRouting();
+    polyVoices.reset();
+    for (auto& state : channelStates)
+        for (auto& lanes : state.poly)
+            lanes.reset();
+}
+
+void DualCoreDSP::setEnvTrigger(EnvTrigger trigger)
+{
+    if (trigger == envTrigger)
+        return;
+
+    // Start released, so neither source is left holding the envelope open
+    envTrigger = trigger;
+    envTriggered = false;
+    adsrEnv.release();
+}
+
+void DualCoreDSP::setLFORetrigger(bool enabled)
+{
+    lfoRetrigger = enabled;
+}
+
+void DualCoreDSP::setKeyTracking(float amount)
+{
+    keyTracking = juce::jlimit(0.0f, 1.0f, amount);
+}
+
+void DualCoreDSP::setChannelExcluded(int channel, bool excluded)
+{
+    if (channel < 0 || channel >= MAX_CHANNELS)
+        return;
+
+    channelStates[static_cast<size_t>(channel)].excluded = excluded;
+}
+
+int DualCoreDSP::getLatencySamples() const
+{
+    int latency = lookaheadSamples;
+    if (limiterEnabled)
+        latency += channelStates[0].inputLimiter.getLatencySamples();
+    if (outputLimiterEnabled)
+        latency += channelStates[0].outputLimiter.getLatencySamples();
+    return latency;
+}
+
+void DualCoreDSP::setFilterFrequency(int filterIndex, float freqHz)
+{
+    for (auto& state : channelStates)
+    {
+        auto& filter = state.filters[static_cast<size_t>(filterIndex)];
+        filter.frequency = freqHz;
+        filter.updateCoefficients(sampleRate);
+    }
+}
+
+void DualCoreDSP::setFilterResonance(int filterIndex, float resonance)
+{
+    for (auto& state : channelStates)
+    {
+        auto& filter = state.filters[static_cast<size_t>(filterIndex)];
+        filter.resonance = resonance;
+        filter.updateCoefficients(sampleRate);
+    }
+}
+
+void DualCoreDSP::setFilter1Frequency(float freqHz)
+{
+    filter1BaseFreq = freqHz;
+    setFilterFrequency(0, freqHz);
+}
+
+void DualCoreDSP::setFilter1Resonance(float resonance)
+{
+    filter1BaseReso = resonance;
+    setFilterResonance(0, resonance);
+}
+
+void DualCoreDSP::setFilter1Mode(FilterMode mode)
+{
+    filter1Mode = mode;
+    filter1BaseMorph = getMorphPosition(filter1Mode, filter1Morph);
+}
+
+void DualCoreDSP::setFilter1Morph(float morph)
+{
+    filter1Morph = juce::jlimit(0.0f, 1.0f, morph);
+    filter1BaseMorph = getMorphPosition(filter1Mode, filter1Morph);
+}
+
+void DualCoreDSP::setFilter2Frequency(float freqHz)
+{
+    filter2BaseFreq = freqHz;
+    setFilterFrequency(1, freqHz);
+}
+
+void DualCoreDSP::setFilter2Resonance(float resonance)
+{
+    filter2BaseReso = resonance;
+    setFilterResonance(1, resonance);
+}
+
+void DualCoreDSP::setFilter2Mode(FilterMode mode)
+{
+    filter2Mode = mode;
+    filter2BaseMorph = getMorphPosition(filter2Mode, filter2Morph);
+}
+
+void DualCoreDSP::setFilter2Morph(float morph)
+{
+    filter2Morph = juce::jlimit(0.0f, 1.0f, morph);
+    filter2BaseMorph = getMorphPosition(filter2Mode, filter2Morph);
+}
+
+void DualCoreDSP::setFilter1Type(FilterType type)
+{
+    // Switching crossfades from the old engine instead of resetting it (click-free)
+    filter1BaseType = type;
+    requestFilterType(0, filter1Fade, type);
+}
+
+void DualCoreDSP::setFilter2Type(FilterType type)
+{
+    filter2BaseType = type;
+    requestFilterType(1, filter2Fade, type);
+}
+
+void DualCoreDSP::setFMAmount(float amount)
+{
+    fmAmount = amount;
+}
+
+void DualCoreDSP::setEnvAttack(float ms)
+{
+    adsrEnv.setAttack(ms, sampleRate);
+}
+
+void DualCoreDSP::setEnvDecay(float ms)
+{
+    adsrEnv.setDecay(ms, sampleRate);
+}
+
+void DualCoreDSP::setEnvSustain(float level)
+{
+    adsrEnv.setSustain(level);
+}
+
+void DualCoreDSP::setEnvRelease(float ms)
+{
+    adsrEnv.setRelease(ms, sampleRate);
+}
+
+void DualCoreDSP::setEnvAmount(float amount)
+{
+    envAmount = amount;
+}
+
+void DualCoreDSP::setEnvSensitivity(float sens)
+{
+    envSensitivity = juce::jlimit(0.0f, 1.0f, sens);
+}
+
+void DualCoreDSP::setDetectorSource(DetectorSource source)
+{
+    detectorSource = source;
+}
+
+void DualCoreDSP::setFMSource(FMSource source)
+{
+    fmSource = source;
+}
+
+void DualCoreDSP::setCrossMod(CrossModPath path, float amount, bool exponential)
+{
+    const auto index = static_cast<size_t>(path);
+    if (index >= crossModAmount.size())
+        return;
+
+    crossModAmount[index] = juce::jlimit(0.0f, 1.0f, amount);
+    crossModExp[index] = exponential;
+    crossModActive = crossModAmount[0] > 0.0f || crossModAmount[1] > 0.0f;
+}
+
+void DualCoreDSP::computeMonoSum(const juce::AudioBuffer<float>& source, int numSamples, float gain, float* dest)
+{
+    const int numSourceChannels = source.getNumChannels();
+    const float scale = gain / static_cast<float>(juce::jmax(1, numSourceChannels));
+
+    juce::FloatVectorOperations::copyWithMultiply(dest, source.getReadPointer(0), scale, numSamples);
+    for (int ch = 1; ch < numSourceChannels; ++ch)
+        juce::FloatVectorOperations::addWithMultiply(dest, source.getReadPointer(ch), scale, numSamples);
+}
+
+void DualCoreDSP::setLookahead(float ms)
+{
+    // The delays only run while lookahead is on, so they are cleared when it comes back
+    const int previousSamples = lookaheadSamples;
+    lookaheadMs = juce::jlimit(0.0f, MAX_LOOKAHEAD_MS, ms);
+    lookaheadSamples = juce::jmin(static_cast<int>(std::round(sampleRate * lookaheadMs * 0.001)),
+                                  static_cast<int>(channelStates[0].lookahead.buffer.size()) - 1);
+    lookaheadSamples = juce::jmax(0, lookaheadSamples);
+    lookaheadResetPending = lookaheadResetPending || (lookaheadSamples > 0 && previousSamples == 0);
+    for (auto& state : channelStates)
+        state.lookahead.setDelay(lookaheadSamples);
+    sidechainLookahead.setDelay(lookaheadSamples);
+}
+
+void DualCoreDSP::setLFORate(float hz)
+{
+    lfoBaseRate = hz;
+    lfo.setRate(hz, sampleRate);
+}
+
+void DualCoreDSP::setLFODepth(float depth)
+{
+    lfoDepth = depth;
+}
+
+void DualCoreDSP::setLFOWaveform(LFOWaveform wave)
+{
+    lfo.waveform = wave;
+}
+
+void DualCoreDSP::setLFOTarget(int target)
+{
+    lfoTarget = juce::jlimit(0, 2, target);
+}
+
+void DualCoreDSP::setLFO2Rate(float hz)
+{
+    lfo2BaseRate = hz;
+    lfo2.setRate(hz, sampleRate);
+}
+
+void DualCoreDSP::setLFO2Depth(float depth)
+{
+    lfo2Depth = depth;
+}
+
+void DualCoreDSP::setLFO2Waveform(LFOWaveform wave)
+{
+    lfo2.waveform = wave;
+}
+
+void DualCoreDSP::setLFOSync(bool sync)
+{
+    lfoSyncEnabled = sync;
+    if (sync)
+    {
+        // Recalculate rate from BPM and division
+        setLFODivision(lfoDivision);
+    }
+    else
+    {
+        // Restore free-running rate
+        lfo.setRate(lfoBaseRate, sampleRate);
+    }
+}
+
+void DualCoreDSP::setLFODivision(NoteDivision div)
+{
+    lfoDivision = div;
+    if (lfoSyncEnabled)
+    {
+        // Calculate rate from BPM and note division
+        // Quarter note = 1 beat, so 1/4 note frequency = BPM/60
+        const float quarterNoteHz = static_cast<float>(hostBPM) / 60.0f;
+        const float rate = quarterNoteHz / static_cast<float>(getDivisionQuarterNotes(div));
+        lfo.setRate(rate, sampleRate);
+    }
+}
+
+void DualCoreDSP::setLFOAudioRate(float hz)
+{
+    lfo.audioRate = juce::jlimit(0.0f, MAX_LFO_AUDIO_RATE, hz);
+}
+
+void DualCoreDSP::setLFO2AudioRate(float hz)
+{
+    lfo2.audioRate = juce::jlimit(0.0f, MAX_LFO_AUDIO_RATE, hz);
+}
+
+void DualCoreDSP::setLFO2Sync(bool sync)
+{
+    lfo2SyncEnabled = sync;
+    if (sync)
+    {
+        setLFO2Division(lfo2Division);
+    }
+    else
+    {
+        lfo2.setRate(lfo2BaseRate, sampleRate);
+    }
+}
+
+void DualCoreDSP::setLFO2Division(NoteDivision div)
+{
+    lfo2Division = div;
+    if (lfo2SyncEnabled)
+    {
+        const float quarterNoteHz = static_cast<float>(hostBPM) / 60.0f;
+        const float rate = quarterNoteHz / static_cast<float>(getDivisionQuarterNotes(div));
+        lfo2.setRate(rate, sampleRate);
+    }
+}
+
+void DualCoreDSP::setHostBPM(double bpm)
+{
+    hostBPM = juce::jlimit(20.0, 300.0, bpm);
+    // Update synced LFOs
+    if (lfoSyncEnabled)
+        setLFODivision(lfoDivision);
+    if (lfo2SyncEnabled)
+        setLFO2Division(lfo2Division);
+}
+
+void DualCoreDSP::setHostPosition(double ppqPosition, bool playing)
+{
+    hostPpq = ppqPosition;
+    hostPlaying = playing;
+}
+
+double DualCoreDSP::getDivisionQuarterNotes(NoteDivision div)
+{
+    switch (div)
+    {
+        case NoteDivision::Div_4_1:   return 16.0;  // 4 bars
+        case NoteDivision::Div_2_1:   return 8.0;   // 2 bars
+        case NoteDivision::Div_1_1:   return 4.0;   // 1 bar
+        case NoteDivision::Div_1_2:   return 2.0;
+        case NoteDivision::Div_1_4:   return 1.0;
+        case NoteDivision::Div_1_8:   return 0.5;
+        case NoteDivision::Div_1_16:  return 0.25;
+        case NoteDivision::Div_1_32:  return 0.125;
+        case NoteDivision::Div_1_2T:  return 2.0 / 1.5;  // Triplet
+        case NoteDivision::Div_1_4T:  return 1.0 / 1.5;
+        case NoteDivision::Div_1_8T:  return 0.5 / 1.5;
+        case NoteDivision::Div_1_16T: return 0.25 / 1.5;
+        case NoteDivision::Div_1_2D:  return 2.0 * 1.5;  // Dotted
+        case NoteDivision::Div_1_4D:  return 1.0 * 1.5;
+        case NoteDivision::Div_1_8D:  return 0.5 * 1.5;
+        case NoteDivision::Div_1_16D: return 0.25 * 1.5;
+    }
+    return 1.0;
+}
+
+//==============================================================================
+// Step Sequencer
+
+void DualCoreDSP::setSequencerLength(int steps)
 {
-    limiterEnabled = enabled;
+    sequencerLength = juce::jlimit(1, MAX_SEQ_STEPS, steps);
 }
 
-void DualCoreDSP::setFilter1Frequency(float freqHz)
+void DualCoreDSP::setSequencerDivision(NoteDivision div)
 {
-    filter1BaseFreq = freqHz;
-    filter1L.frequency = freqHz;
-    filter1R.frequency = freqHz;
-    filter1L.updateCoefficients(sampleRate);
-    filter1R.updateCoefficients(sampleRate);
+    sequencerDivision = div;
 }
 
-void DualCoreDSP::setFilter1Resonance(float resonance)
+void DualCoreDSP::setSequencerGateLength(float length)
 {
-    filter1BaseReso = resonance;
-    filter1L.resonance = resonance;
-    filter1R.resonance = resonance;
-    filter1L.updateCoefficients(sampleRate);
-    filter1R.updateCoefficients(sampleRate);
+    sequencerGateLength = juce::jlimit(0.05f, 1.0f, length);
 }
 
-void DualCoreDSP::setFilter1Mode(FilterMode mode)
+void DualCoreDSP::setSequencerStep(int step, float value, bool gate, bool glide)
 {
-    filter1L.mode = mode;
-    filter1R.mode = mode;
+    if (step >= 0 && step < MAX_SEQ_STEPS)
+    {
+        auto& s = sequencerSteps[static_cast<size_t>(step)];
+        s.value = juce::jlimit(-1.0f, 1.0f, value);
+        s.gate = gate;
+        s.glide = glide;
+    }
 }
 
-void DualCoreDSP::setFilter2Frequency(float freqHz)
+void DualCoreDSP::renderSequencer(int numSamples)
 {
-    filter2BaseFreq = freqHz;
-    filter2L.frequency = freqHz;
-    filter2R.frequency = freqHz;
-    filter2L.updateCoefficients(sampleRate);
-    filter2R.updateCoefficients(sampleRate);
+    // Locked to the host's PPQ while it plays, free-running from the last position otherwise
+    if (hostPlaying)
+        sequencerPpq = hostPpq;
+
+    const double stepQuarters = getDivisionQuarterNotes(sequencerDivision);
+    const double quartersPerSample = hostBPM / (60.0 * sampleRate);
+    const double blockQuarters = quartersPerSample * numSamples;
+    auto stepAt = [this, stepQuarters](double ppq)
+    {
+        const auto step = static_cast<long long>(std::floor(ppq / stepQuarters)) % sequencerLength;
+        return static_cast<int>(step < 0 ? step + sequencerLength : step);
+    };
+
+    if (!sequencerRouted)
+    {
+        // Nothing reads the output; just keep the position (and the display) moving
+        sequencerPpq += blockQuarters;
+        sequencerStep = stepAt(sequencerPpq);
+        return;
+    }
+
+    // The block is rendered a segment at a time: each segment is the part of one step
+    // (gate on, gate off, or a glide ramp) that falls inside the block, so the step table
+    // is read once per segment rather than per sample
+    double ppq = sequencerPpq;
+    int sample = 0;
+    while (sample < numSamples)
+    {
+        const double stepPosition = ppq / stepQuarters;
+        const double stepStart = std::floor(stepPosition);
+        const int step = stepAt(ppq);
+        const auto& current = sequencerSteps[static_cast<size_t>(step)];
+        const double phase = stepPosition - stepStart;  // 0 to 1 through the step
+
+        // End of this segment, in step phase: the gate edge or the end of the step
+        double segmentEnd = 1.0;
+        if (current.gate && !current.glide && phase < sequencerGateLength)
+            segmentEnd = sequencerGateLength;
+
+        const int segmentSamples = juce::jlimit(1, numSamples - sample,
+            static_cast<int>(std::ceil((segmentEnd - phase) * stepQuarters / quartersPerSample)));
+        float* out = sequencerBlock.data() + sample;
+
+        if (current.gate && current.glide)
+        {
+            const auto& next = sequencerSteps[static_cast<size_t>((step + 1) % sequencerLength)];
+            const float target = next.gate ? next.value : -1.0f;
+            const float perSample = static_cast<float>(quartersPerSample / stepQuarters);
+            const float start = current.value + (target - current.value) * static_cast<float>(phase);
+            const float increment = (target - current.value) * perSample;
+            for (int i = 0; i < segmentSamples; ++i)
+                out[i] = start + increment * static_cast<float>(i);
+        }
+        else
+        {
+            const float value = (current.gate && phase < sequencerGateLength) ? current.value : -1.0f;
+            juce::FloatVectorOperations::fill(out, value, segmentSamples);
+        }
+
+        sequencerStep = step;
+        sample += segmentSamples;
+        ppq += quartersPerSample * segmentSamples;
+    }
+    sequencerPpq += blockQuarters;
+
+    // ~1 ms slew so gate edges don't click when the sequencer drives gain-like targets
+    float state = sequencerSlewState;
+    for (int i = 0; i < numSamples; ++i)
+    {
+        state += (sequencerBlock[static_cast<size_t>(i)] - state) * sequencerSlewCoef;
+        sequencerBlock[static_cast<size_t>(i)] = state;
+    }
+    sequencerSlewState = state;
 }
 
-void DualCoreDSP::setFilter2Resonance(float resonance)
+void DualCoreDSP::setModSlot(int slotIndex, ModSource source, ModDestination dest, float amount)
 {
-    filter2BaseReso = resonance;
-    filter2L.resonance = resonance;
-    filter2R.resonance = resonance;
-    filter2L.updateCoefficients(sampleRate);
-    filter2R.updateCoefficients(sampleRate);
+    if (slotIndex >= 0 && slotIndex < NUM_MOD_SLOTS)
+    {
+        auto& slot = modSlots[slotIndex];
+        amount = juce::jlimit(-1.0f, 1.0f, amount);
+        if (slot.source != source || slot.destination != dest || slot.amount != amount)
+        {
+            slot.source = source;
+            slot.destination = dest;
+            slot.amount = amount;
+            modRoutingDirty = true;
+        }
+    }
 }
 
-void DualCoreDSP::setFilter2Mode(FilterMode mode)
+void DualCoreDSP::setMacro(int index, float value)
 {
-    filter2L.mode = mode;
-    filter2R.mode = mode;
+    if (index >= 0 && index < NUM_MACROS)
+        macroValues[static_cast<size_t>(index)] = juce::jlimit(0.0f, 1.0f, value);
 }
 
-void DualCoreDSP::setFilter1Type(FilterType type)
+void DualCoreDSP::setMacroTarget(int targetIndex, const MacroTarget& target)
 {
-    if (filter1L.type != type || filter1R.type != type)
+    if (targetIndex < 0 || targetIndex >= NUM_MACRO_TARGETS)
+        return;
+
+    auto& current = macroTargets[static_cast<size_t>(targetIndex)];
+    MacroTarget clamped = target;
+    clamped.macro = juce::jlimit(-1, NUM_MACROS - 1, target.macro);
+    clamped.rangeMin = juce::jlimit(-1.0f, 1.0f, target.rangeMin);
+    clamped.rangeMax = juce::jlimit(-1.0f, 1.0f, target.rangeMax);
+    clamped.curve = juce::jlimit(-1.0f, 1.0f, target.curve);
+
+    if (current.macro != clamped.macro || current.destination != clamped.destination
+        || current.rangeMin != clamped.rangeMin || current.rangeMax != clamped.rangeMax
+        || current.curve != clamped.curve)
     {
-        filter1L.type = type;
-        filter1R.type = type;
-        filter1L.reset();
-        filter1R.reset();
-        filter1L.updateCoefficients(sampleRate);
-        filter1R.updateCoefficients(sampleRate);
+        current = clamped;
+        modRoutingDirty = true;
     }
 }
 
-void DualCoreDSP::setFilter2Type(FilterType type)
+void DualCoreDSP::compileModRouting()
 {
-    if (filter2L.type != type || filter2R.type != type)
+    compileSlotRouting(modSlots, panelRouting);
+
+    numMacroRoutes = 0;
+    for (const auto& target : macroTargets)
     {
-        filter2L.type = type;
-        filter2R.type = type;
-        filter2L.reset();
-        filter2R.reset();
-        filter2L.updateCoefficients(sampleRate);
-        filter2R.updateCoefficients(sampleRate);
+        if (target.macro < 0 || target.destination == ModDestination::None)
+            continue;
+
+        auto& route = macroRoutes[static_cast<size_t>(numMacroRoutes++)];
+        route.source = static_cast<int>(ModSource::Macro1) + target.macro;
+        route.destination = static_cast<int>(target.destination);
+        route.amount = target.rangeMax - target.rangeMin;
+        route.offset = target.rangeMin;
+        route.exponent = std::exp2(-2.0f * target.curve);  // Curve exponent 1/4 to 4
+        route.amountDestination = -1;
+        route.carried = false;
     }
-}
 
-void DualCoreDSP::setFMAmount(float amount)
-{
-    fmAmount = amount;
+    updateSourceRouting();
+    carriedModulation.fill(0.0f);
+    modRoutingDirty = false;
 }
 
-void DualCoreDSP::setEnvAttack(float ms)
+void DualCoreDSP::compileSlotRouting(const std::array<ModulationSlot, NUM_MOD_SLOTS>& slots, ModRoutingTable& table) const
 {
-    adsrEnv.setAttack(ms, sampleRate);
+    // Slot routes are ordered so every slot runs after the slots modulating its amount
+    // (depth-first, modulators first). A route writing to a slot that already ran closes
+    // a cycle: its contribution is carried to the next sample instead of being dropped
+    auto slotActive = [&slots](int slot)
+    {
+        const auto& s = slots[static_cast<size_t>(slot)];
+        return s.source != ModSource::None && s.destination != ModDestination::None;
+    };
+    auto amountDestination = [](int slot) { return static_cast<int>(ModDestination::Slot1Amount) + slot; };
+
+    enum class Visit { None, Active, Done };
+    std::array<Visit, NUM_MOD_SLOTS> visit{};
+    std::array<int, NUM_MOD_SLOTS> order{};
+    int orderSize = 0;
+
+    auto visitSlot = [&](auto& self, int slot) -> void
+    {
+        visit[static_cast<size_t>(slot)] = Visit::Active;
+        for (int modulator = 0; modulator < NUM_MOD_SLOTS; ++modulator)
+        {
+            if (!slotActive(modulator)
+                || static_cast<int>(slots[static_cast<size_t>(modulator)].destination) != amountDestination(slot))
+                continue;
+
+            if (visit[static_cast<size_t>(modulator)] == Visit::None)
+                self(self, modulator);
+        }
+        visit[static_cast<size_t>(slot)] = Visit::Done;
+        order[static_cast<size_t>(orderSize++)] = slot;
+    };
+
+    for (int slot = 0; slot < NUM_MOD_SLOTS; ++slot)
+        if (slotActive(slot) && visit[static_cast<size_t>(slot)] == Visit::None)
+            visitSlot(visitSlot, slot);
+
+    // Position of each slot in the evaluation order, to spot writes to slots already run
+    std::array<int, NUM_MOD_SLOTS> position{};
+    for (int index = 0; index < orderSize; ++index)
+        position[static_cast<size_t>(order[static_cast<size_t>(index)])] = index;
+
+    table.numRoutes = 0;
+    table.cycleDetected = false;
+    table.usesSequencer = false;
+    table.usesSpectral = false;
+    for (int index = 0; index < orderSize; ++index)
+    {
+        const int slot = order[static_cast<size_t>(index)];
+        const auto& modSlot = slots[static_cast<size_t>(slot)];
+        auto& route = table.routes[static_cast<size_t>(table.numRoutes++)];
+        route.source = static_cast<int>(modSlot.source);
+        route.destination = static_cast<int>(modSlot.destination);
+        route.amount = modSlot.amount;
+        route.offset = 0.0f;
+        route.exponent = 1.0f;
+        route.amountDestination = amountDestination(slot);
+
+        const int targetSlot = route.destination - amountDestination(0);
+        route.carried = targetSlot >= 0 && targetSlot < NUM_MOD_SLOTS && slotActive(targetSlot)
+                        && position[static_cast<size_t>(targetSlot)] <= index;
+        table.cycleDetected = table.cycleDetected || route.carried;
+        table.usesSequencer = table.usesSequencer || modSlot.source == ModSource::Sequencer;
+        table.usesSpectral = table.usesSpectral
+                             || (modSlot.source >= ModSource::InputLow && modSlot.source <= ModSource::InputBrightness);
+    }
 }
 
-void DualCoreDSP::setEnvDecay(float ms)
+void DualCoreDSP::evaluateModRoutes(const ModRoutingTable& table, std::array<float, NUM_MOD_DESTINATIONS>& modulation,
+                                    std::array<float, NUM_MOD_DESTINATIONS>& carried) const
 {
-    adsrEnv.setDecay(ms, sampleRate);
+    if (table.cycleDetected)
+    {
+        for (size_t dest = 0; dest < modulation.size(); ++dest)
+            modulation[dest] += carried[dest];
+        carried.fill(0.0f);
+    }
+
+    for (int route = 0; route < table.numRoutes; ++route)
+    {
+        const auto& modRoute = table.routes[static_cast<size_t>(route)];
+        float amount = modRoute.amount;
+        if (modRoute.amountDestination >= 0)
+            amount = juce::jlimit(-1.0f, 1.0f, amount + modulation[static_cast<size_t>(modRoute.amountDestination)]);
+
+        auto& target = modRoute.carried ? carried : modulation;
+        target[static_cast<size_t>(modRoute.destination)] += modSourceValues[static_cast<size_t>(modRoute.source)] * amount;
+    }
 }
 
-void DualCoreDSP::setEnvSustain(float level)
+void DualCoreDSP::updateStaticModulation()
 {
-    adsrEnv.setSustain(level);
+    for (int macro = 0; macro < NUM_MACROS; ++macro)
+        modSourceValues[static_cast<size_t>(ModSource::Macro1) + static_cast<size_t>(macro)] = macroValues[static_cast<size_t>(macro)];
+
+    staticModulation.fill(0.0f);
+    for (int index = 0; index < numMacroRoutes; ++index)
+    {
+        const auto& route = macroRoutes[static_cast<size_t>(index)];
+        const float macro = modSourceValues[static_cast<size_t>(route.source)];
+        const float shaped = (route.exponent == 1.0f) ? macro : std::pow(macro, route.exponent);
+        staticModulation[static_cast<size_t>(route.destination)] += route.offset + shaped * route.amount;
+    }
 }
 
-void DualCoreDSP::setEnvRelease(float ms)
+void DualCoreDSP::updateSourceRouting()
 {
-    adsrEnv.setRelease(ms, sampleRate);
+    // Any table that may be recalled counts, since a snapshot can switch in mid-block
+    sequencerRouted = panelRouting.usesSequencer;
+    spectralRouted = panelRouting.usesSpectral;
+    for (const auto& snapshot : snapshots)
+    {
+        sequencerRouted = sequencerRouted || (snapshot.stored && snapshot.routing.usesSequencer);
+        spectralRouted = spectralRouted || (snapshot.stored && snapshot.routing.usesSpectral);
+    }
 }
 
-void DualCoreDSP::setEnvAmount(float amount)
+//==============================================================================
+// Snapshots
+
+void DualCoreDSP::setSnapshot(int index, const Snapshot& snapshot)
 {
-    envAmount = amount;
+    if (index < 0 || index >= NUM_SNAPSHOTS)
+        return;
+
+    // Everything the per-sample loop needs is worked out here, so a recall is a pointer
+    // swap plus a crossfade
+    auto& prepared = snapshots[static_cast<size_t>(index)];
+    auto& settings = prepared.sound;
+    settings.filter1Freq = juce::jlimit(20.0f, 20000.0f, snapshot.filter1Freq);
+    settings.filter1Octaves = std::log2(settings.filter1Freq);
+    settings.filter1Reso = juce::jlimit(0.0f, 1.0f, snapshot.filter1Reso);
+    settings.filter1Morph = getMorphPosition(snapshot.filter1Mode, juce::jlimit(0.0f, 1.0f, snapshot.filter1Morph));
+    settings.filter1Type = snapshot.filter1Type;
+    settings.filter2Freq = juce::jlimit(20.0f, 20000.0f, snapshot.filter2Freq);
+    settings.filter2Octaves = std::log2(settings.filter2Freq);
+    settings.filter2Reso = juce::jlimit(0.0f, 1.0f, snapshot.filter2Reso);
+    settings.filter2Morph = getMorphPosition(snapshot.filter2Mode, juce::jlimit(0.0f, 1.0f, snapshot.filter2Morph));
+    settings.filter2Type = snapshot.filter2Type;
+    settings.fmAmount = snapshot.fmAmount;
+    settings.driveAmount = juce::jlimit(0.0f, 1.0f, snapshot.driveAmount);
+    settings.driveType = snapshot.driveType;
+    settings.dryWetMix = snapshot.dryWetMix;
+    settings.amAmount = snapshot.amAmount;
+    settings.routingBalance = juce::jlimit(0.0f, 1.0f, snapshot.routingBalance);
+    settings.envAmount = snapshot.envAmount;
+    settings.lfoDepth = snapshot.lfoDepth;
+
+    auto slots = snapshot.modSlots;
+    for (auto& slot : slots)
+        slot.amount = juce::jlimit(-1.0f, 1.0f, slot.amount);
+    compileSlotRouting(slots, prepared.routing);
+
+    prepared.stored = true;
+    updateSourceRouting();
 }
 
-void DualCoreDSP::setEnvSensitivity(float sens)
+void DualCoreDSP::clearSnapshot(int index)
 {
-    envSensitivity = juce::jlimit(0.0f, 1.0f, sens);
+    if (index < 0 || index >= NUM_SNAPSHOTS)
+        return;
+
+    snapshots[static_cast<size_t>(index)].stored = false;
+    updateSourceRouting();
 }
 
-void DualCoreDSP::setLFORate(float hz)
+void DualCoreDSP::setSnapshotMode(SnapshotMode mode)
 {
-    lfoBaseRate = hz;
-    lfo.setRate(hz, sampleRate);
+    snapshotMode = mode;
 }
 
-void DualCoreDSP::setLFODepth(float depth)
+void DualCoreDSP::setSnapshotSelect(int index)
 {
-    lfoDepth = depth;
+    snapshotSelect = juce::jlimit(0, NUM_SNAPSHOTS - 1, index);
 }
 
-void DualCoreDSP::setLFOWaveform(LFOWaveform wave)
+void DualCoreDSP::setSnapshotSequence(int count, NoteDivision div)
 {
-    lfo.waveform = wave;
+    snapshotCount = juce::jlimit(1, NUM_SNAPSHOTS, count);
+    snapshotDivision = div;
 }
 
-void DualCoreDSP::setLFOTarget(int target)
+void DualCoreDSP::setSnapshotFade(float ms)
 {
-    lfoTarget = juce::jlimit(0, 2, target);
+    snapshotFadeMs = juce::jlimit(0.0f, MAX_SNAPSHOT_FADE_MS, ms);
 }
 
-void DualCoreDSP::setLFO2Rate(float hz)
+int DualCoreDSP::getPlayableSnapshot(int index) const
 {
-    lfo2BaseRate = hz;
-    lfo2.setRate(hz, sampleRate);
+    return (index >= 0 && snapshots[static_cast<size_t>(index)].stored) ? index : -1;
 }
 
-void DualCoreDSP::setLFO2Depth(float depth)
+const DualCoreDSP::SoundSettings& DualCoreDSP::getSnapshotSound(int index) const
 {
-    lfo2Depth = depth;
+    return index >= 0 ? snapshots[static_cast<size_t>(index)].sound : panelSound;
 }
 
-void DualCoreDSP::setLFO2Waveform(LFOWaveform wave)
+const DualCoreDSP::ModRoutingTable& DualCoreDSP::getSnapshotRouting(int index) const
 {
-    lfo2.waveform = wave;
+    return index >= 0 ? snapshots[static_cast<size_t>(index)].routing : panelRouting;
 }
 
-void DualCoreDSP::setLFOSync(bool sync)
+void DualCoreDSP::updateSnapshots(int numSamples)
 {
-    lfoSyncEnabled = sync;
-    if (sync)
+    // The panel as a snapshot, from the values the setters left this block
+    panelSound.filter1Freq = juce::jlimit(20.0f, 20000.0f, filter1BaseFreq);
+    panelSound.filter1Octaves = std::log2(panelSound.filter1Freq);
+    panelSound.filter1Reso = filter1BaseReso;
+    panelSound.filter1Morph = filter1BaseMorph;
+    panelSound.filter1Type = filter1BaseType;
+    panelSound.filter2Freq = juce::jlimit(20.0f, 20000.0f, filter2BaseFreq);
+    panelSound.filter2Octaves = std::log2(panelSound.filter2Freq);
+    panelSound.filter2Reso = filter2BaseReso;
+    panelSound.filter2Morph = filter2BaseMorph;
+    panelSound.filter2Type = filter2BaseType;
+    panelSound.fmAmount = fmAmount;
+    panelSound.driveAmount = driveAmount;
+    panelSound.driveType = driveType;
+    panelSound.dryWetMix = dryWetMix;
+    panelSound.amAmount = amAmount;
+    panelSound.routingBalance = routingBalance;
+    panelSound.envAmount = envAmount;
+    panelSound.lfoDepth = lfoDepth;
+
+    // Grid position: the host's while it plays, free-running otherwise
+    if (hostPlaying)
+        snapshotPpq = hostPpq;
+    const double quartersPerSample = hostBPM / (60.0 * sampleRate);
+    const double gridQuarters = getDivisionQuarterNotes(snapshotDivision);
+    const double gridPosition = snapshotPpq / gridQuarters;
+    const double gridStep = std::floor(gridPosition);
+    snapshotPpq += quartersPerSample * numSamples;
+
+    auto sequenceIndex = [this](double step)
     {
-        // Recalculate rate from BPM and division
-        setLFODivision(lfoDivision);
-    }
-    else
-    {
-        // Restore free-running rate
-        lfo.setRate(lfoBaseRate, sampleRate);
-    }
-}
+        const auto index = static_cast<long long>(step) % snapshotCount;
+        return static_cast<int>(index < 0 ? index + snapshotCount : index);
+    };
 
-void DualCoreDSP::setLFODivision(NoteDivision div)
-{
-    lfoDivision = div;
-    if (lfoSyncEnabled)
+    const float fadeIncrement = 1.0f / juce::jmax(1.0f, snapshotFadeMs * 0.001f * static_cast<float>(sampleRate));
+    snapshotSwitchSample = -1;
+    int target = -1;
+
+    switch (snapshotMode)
     {
-        // Calculate rate from BPM and note division
-        // Quarter note = 1 beat, so 1/4 note frequency = BPM/60
-        float quarterNoteHz = static_cast<float>(hostBPM) / 60.0f;
-        float rate = quarterNoteHz;
+        case SnapshotMode::Off:
+            break;
+
+        case SnapshotMode::Manual:
+            target = getPlayableSnapshot(snapshotSelect);
+            break;
 
-        switch (div)
+        case SnapshotMode::Step:
         {
-            case NoteDivision::Div_4_1:  rate = quarterNoteHz / 16.0f; break;  // 4 bars
-            case NoteDivision::Div_2_1:  rate = quarterNoteHz / 8.0f;  break;  // 2 bars
-            case NoteDivision::Div_1_1:  rate = quarterNoteHz / 4.0f;  break;  // 1 bar
-            case NoteDivision::Div_1_2:  rate = quarterNoteHz / 2.0f;  break;
-            case NoteDivision::Div_1_4:  rate = quarterNoteHz;         break;
-            case NoteDivision::Div_1_8:  rate = quarterNoteHz * 2.0f;  break;
-            case NoteDivision::Div_1_16: rate = quarterNoteHz * 4.0f;  break;
-            case NoteDivision::Div_1_32: rate = quarterNoteHz * 8.0f;  break;
-            case NoteDivision::Div_1_2T: rate = quarterNoteHz / 2.0f * 1.5f;  break;  // Triplet
-            case NoteDivision::Div_1_4T: rate = quarterNoteHz * 1.5f;         break;
-            case NoteDivision::Div_1_8T: rate = quarterNoteHz * 2.0f * 1.5f;  break;
-            case NoteDivision::Div_1_16T: rate = quarterNoteHz * 4.0f * 1.5f; break;
-            case NoteDivision::Div_1_2D: rate = quarterNoteHz / 2.0f / 1.5f;  break;  // Dotted
-            case NoteDivision::Div_1_4D: rate = quarterNoteHz / 1.5f;         break;
-            case NoteDivision::Div_1_8D: rate = quarterNoteHz * 2.0f / 1.5f;  break;
-            case NoteDivision::Div_1_16D: rate = quarterNoteHz * 4.0f / 1.5f; break;
+            target = getPlayableSnapshot(sequenceIndex(gridStep));
+
+            // The next grid line, if it falls inside this block, switches at its exact sample
+            const double samplesToNext = (gridStep + 1.0 - gridPosition) * gridQuarters / quartersPerSample;
+            if (samplesToNext < numSamples)
+            {
+                snapshotSwitchSample = static_cast<int>(std::ceil(samplesToNext));
+                snapshotSwitchIndex = getPlayableSnapshot(sequenceIndex(gridStep + 1.0));
+            }
+            break;
         }
 
-        lfo.setRate(rate, sampleRate);
+        case SnapshotMode::Glide:
+        {
+            // A crossfade that spans the whole grid step, restarted at the current phase every block
+            const int from = getPlayableSnapshot(sequenceIndex(gridStep));
+            activeSnapshot = getPlayableSnapshot(sequenceIndex(gridStep + 1.0));
+            fadeFromSound = getSnapshotSound(from);
+            fadeFromRouting = &getSnapshotRouting(from);
+            modRouting = &getSnapshotRouting(activeSnapshot);
+            snapshotFade = static_cast<float>(gridPosition - gridStep);
+            snapshotFadeIncrement = static_cast<float>(quartersPerSample / gridQuarters);
+            sound = blendSound(fadeFromSound, getSnapshotSound(activeSnapshot), snapshotFade);
+            return;
+        }
     }
-}
 
-void DualCoreDSP::setLFO2Sync(bool sync)
-{
-    lfo2SyncEnabled = sync;
-    if (sync)
+    if (target != activeSnapshot)
     {
-        setLFO2Division(lfo2Division);
+        startSnapshotFade(target, fadeIncrement);
     }
-    else
+    else if (snapshotFade >= 1.0f)
     {
-        lfo2.setRate(lfo2BaseRate, sampleRate);
+        // Settled: pick up panel moves and re-stored snapshots
+        sound = getSnapshotSound(activeSnapshot);
+        modRouting = &getSnapshotRouting(activeSnapshot);
     }
 }
 
-void DualCoreDSP::setLFO2Division(NoteDivision div)
+void DualCoreDSP::startSnapshotFade(int index, float increment)
 {
-    lfo2Division = div;
-    if (lfo2SyncEnabled)
-    {
-        float quarterNoteHz = static_cast<float>(hostBPM) / 60.0f;
-        float rate = quarterNoteHz;
-
-        switch (div)
-        {
-            case NoteDivision::Div_4_1:  rate = quarterNoteHz / 16.0f; break;
-            case NoteDivision::Div_2_1:  rate = quarterNoteHz / 8.0f;  break;
-            case NoteDivision::Div_1_1:  rate = quarterNoteHz / 4.0f;  break;
-            case NoteDivision::Div_1_2:  rate = quarterNoteHz / 2.0f;  break;
-            case NoteDivision::Div_1_4:  rate = quarterNoteHz;         break;
-            case NoteDivision::Div_1_8:  rate = quarterNoteHz * 2.0f;  break;
-            case NoteDivision::Div_1_16: rate = quarterNoteHz * 4.0f;  break;
-            case NoteDivision::Div_1_32: rate = quarterNoteHz * 8.0f;  break;
-            case NoteDivision::Div_1_2T: rate = quarterNoteHz / 2.0f * 1.5f;  break;
-            case NoteDivision::Div_1_4T: rate = quarterNoteHz * 1.5f;         break;
-            case NoteDivision::Div_1_8T: rate = quarterNoteHz * 2.0f * 1.5f;  break;
-            case NoteDivision::Div_1_16T: rate = quarterNoteHz * 4.0f * 1.5f; break;
-            case NoteDivision::Div_1_2D: rate = quarterNoteHz / 2.0f / 1.5f;  break;
-            case NoteDivision::Div_1_4D: rate = quarterNoteHz / 1.5f;         break;
-            case NoteDivision::Div_1_8D: rate = quarterNoteHz * 2.0f / 1.5f;  break;
-            case NoteDivision::Div_1_16D: rate = quarterNoteHz * 4.0f / 1.5f; break;
-        }
-
-        lfo2.setRate(rate, sampleRate);
-    }
+    // Fade from wherever the settings are now, even part-way through another fade
+    fadeFromSound = sound;
+    fadeFromRouting = modRouting;
+    activeSnapshot = index;
+    modRouting = &getSnapshotRouting(index);
+    snapshotFade = 0.0f;
+    snapshotFadeIncrement = increment;
+    carriedModulation.fill(0.0f);
 }
 
-void DualCoreDSP::setHostBPM(double bpm)
+void DualCoreDSP::advanceSnapshotFade()
 {
-    hostBPM = juce::jlimit(20.0, 300.0, bpm);
-    // Update synced LFOs
-    if (lfoSyncEnabled)
-        setLFODivision(lfoDivision);
-    if (lfo2SyncEnabled)
-        setLFO2Division(lfo2Division);
+    snapshotFade = juce::jmin(1.0f, snapshotFade + snapshotFadeIncrement);
+    sound = blendSound(fadeFromSound, getSnapshotSound(activeSnapshot), snapshotFade);
+    if (snapshotFade >= 1.0f)
+        fadeFromRouting = nullptr;
 }
 
-void DualCoreDSP::setModSlot(int slotIndex, ModSource source, ModDestination dest, float amount)
+DualCoreDSP::SoundSettings DualCoreDSP::blendSound(const SoundSettings& from, const SoundSettings& to, float position)
 {
-    if (slotIndex >= 0 && slotIndex < NUM_MOD_SLOTS)
-    {
-        modSlots[slotIndex].source = source;
-        modSlots[slotIndex].destination = dest;
-        modSlots[slotIndex].amount = juce::jlimit(-1.0f, 1.0f, amount);
-    }
+    // Continuous settings are interpolated (cutoffs in octaves); types switch halfway,
+    // where the filter type crossfade takes over
+    auto lerp = [position](float a, float b) { return a + (b - a) * position; };
+    const bool second = position >= 0.5f;
+
+    SoundSettings blended;
+    blended.filter1Octaves = lerp(from.filter1Octaves, to.filter1Octaves);
+    blended.filter1Freq = std::exp2(blended.filter1Octaves);
+    blended.filter1Reso = lerp(from.filter1Reso, to.filter1Reso);
+    blended.filter1Morph = lerp(from.filter1Morph, to.filter1Morph);
+    blended.filter1Type = second ? to.filter1Type : from.filter1Type;
+    blended.filter2Octaves = lerp(from.filter2Octaves, to.filter2Octaves);
+    blended.filter2Freq = std::exp2(blended.filter2Octaves);
+    blended.filter2Reso = lerp(from.filter2Reso, to.filter2Reso);
+    blended.filter2Morph = lerp(from.filter2Morph, to.filter2Morph);
+    blended.filter2Type = second ? to.filter2Type : from.filter2Type;
+    blended.fmAmount = lerp(from.fmAmount, to.fmAmount);
+    blended.driveAmount = lerp(from.driveAmount, to.driveAmount);
+    blended.driveType = second ? to.driveType : from.driveType;
+    blended.dryWetMix = lerp(from.dryWetMix, to.dryWetMix);
+    blended.amAmount = lerp(from.amAmount, to.amAmount);
+    blended.routingBalance = lerp(from.routingBalance, to.routingBalance);
+    blended.envAmount = lerp(from.envAmount, to.envAmount);
+    blended.lfoDepth = lerp(from.lfoDepth, to.lfoDepth);
+    return blended;
 }
 
 void DualCoreDSP::setAMAmount(float amount)
@@ -604,17 +2597,48 @@ void DualCoreDSP::setAMAmount(float amount)
 
 void DualCoreDSP::setAMAttack(float ms)
 {
-    amEnvFollower.setAttack(ms, sampleRate);
+    for (auto& state : channelStates)
+        state.amFollower.setAttack(ms, sampleRate);
 }
 
 void DualCoreDSP::setAMRelease(float ms)
 {
-    amEnvFollower.setRelease(ms, sampleRate);
+    for (auto& state : channelStates)
+        state.amFollower.setRelease(ms, sampleRate);
+}
+
+void DualCoreDSP::setFilterRouting(FilterRouting routing)
+{
+    if (routing == filterRouting)
+        return;
+
+    // Stages that were idle start clean rather than from stale state
+    for (auto& state : channelStates)
+    {
+        for (auto& filter : state.cascade)
+            filter.reset();
+        state.feedbackDelay.reset();
+        state.feedbackSample = 0.0f;
+    }
+
+    filterRouting = routing;
+    compileRouting();
+}
+
+void DualCoreDSP::setRoutingBalance(float balance)
+{
+    routingBalance = juce::jlimit(0.0f, 1.0f, balance);
 }
 
-void DualCoreDSP::setFilterRouting(bool parallel)
+void DualCoreDSP::setFeedback(float amount, float delayMs)
 {
-    parallelRouting = parallel;
+    feedbackAmount = juce::jlimit(0.0f, 0.95f, amount);
+    feedbackDelayMs = juce::jlimit(0.0f, MAX_FEEDBACK_DELAY_MS, delayMs);
+
+    // The stored sample already adds one sample to the loop
+    const int delaySamples = static_cast<int>(std::round(sampleRate * feedbackDelayMs * 0.001));
+    for (auto& state : channelStates)
+        state.feedbackDelay.setDelay(delaySamples);
 }
 
 void DualCoreDSP::setDryWetMix(float wet)
@@ -622,6 +2646,42 @@ void DualCoreDSP::setDryWetMix(float wet)
     dryWetMix = wet;
 }
 
+void DualCoreDSP::setExponentialFreqMod(bool exponential)
+{
+    expFreqMod = exponential;
+}
+
+void DualCoreDSP::setResonanceCompensation(bool enabled)
+{
+    resoCompEnabled = enabled;
+}
+
+void DualCoreDSP::setTapOutputs(int filterIndex, int channel, const TapOutputs& outputs)
+{
+    if (filterIndex < 0 || filterIndex > 1 || channel < 0 || channel >= MAX_CHANNELS)
+        return;
+
+    tapOutputs[static_cast<size_t>(filterIndex)][static_cast<size_t>(channel)] = outputs;
+    tapOutputsActive = true;
+}
+
+void DualCoreDSP::setDryOutput(int channel, float* destination)
+{
+    if (channel < 0 || channel >= MAX_CHANNELS)
+        return;
+
+    dryOutputs[static_cast<size_t>(channel)] = destination;
+    tapOutputsActive = true;
+}
+
+void DualCoreDSP::clearTapOutputs()
+{
+    for (auto& filterOutputs : tapOutputs)
+        filterOutputs.fill({});
+    dryOutputs.fill(nullptr);
+    tapOutputsActive = false;
+}
+
 void DualCoreDSP::setDriveAmount(float amount)
 {
     driveAmount = juce::jlimit(0.0f, 1.0f, amount);
@@ -639,18 +2699,25 @@ void DualCoreDSP::setDrivePrePost(bool post)
 
 // === Saturation/Drive Functions ===
 
-float DualCoreDSP::processDrive(float input)
+float DualCoreDSP::processDrive(float input, float amount, DriveState& state)
 {
     // Scale drive amount to useful range (1.0 to 20.0)
-    float drive = 1.0f + driveAmount * 19.0f;
+    float drive = 1.0f + amount * 19.0f;
+
+    // The folder's ADAA needs the previous driven sample, kept whatever the type so a
+    // switch to Fold starts clean
+    const float lastDriven = state.lastDriven;
+    state.lastDriven = input * drive;
 
-    switch (driveType)
+    switch (sound.driveType)
     {
         case DriveType::Soft:  return saturateSoft(input, drive);
         case DriveType::Tube:  return saturateTube(input, drive);
         case DriveType::Tape:  return saturateTape(input, drive);
         case DriveType::Hard:  return saturateHard(input, drive);
         case DriveType::Fuzz:  return saturateFuzz(input, drive);
+        case DriveType::Fold:  return foldAntialiased(state.lastDriven, lastDriven);
+        case DriveType::Crush: return crush(input, amount, state);
         default: return saturateSoft(input, drive);
     }
 }
@@ -735,19 +2802,153 @@ float DualCoreDSP::saturateFuzz(float input, float drive)
     return juce::jlimit(-1.0f, 1.0f, output);
 }
 
-float DualCoreDSP::softLimit(float input)
+float DualCoreDSP::foldAntialiased(float driven, float lastDriven)
 {
-    // Soft knee limiter
-    const float threshold = 0.8f;
-    const float knee = 0.2f;
+    // First-order ADAA: the folder's average over the segment between the two samples,
+    // which suppresses the aliasing of the sharp fold corners without oversampling
+    const float delta = driven - lastDriven;
+    if (std::abs(delta) < 1.0e-4f)
+        return foldTriangle(0.5f * (driven + lastDriven));
+    return (foldTriangleIntegral(driven) - foldTriangleIntegral(lastDriven)) / delta;
+}
 
-    float absInput = std::abs(input);
-    if (absInput <= threshold)
-        return input;
+float DualCoreDSP::crush(float input, float amount, DriveState& state)
+{
+    // Sample rate divided by up to 32 and depth reduced from 16 to 3 bits as the amount
+    // rises; the held sample is quantised when it is taken
+    const float holdLength = 1.0f + amount * amount * 31.0f;
+    state.holdPhase += 1.0f / holdLength;
+    if (state.holdPhase >= 1.0f)
+    {
+        state.holdPhase -= std::floor(state.holdPhase);
+        const float levels = fastExp2(15.0f - amount * 13.0f);
+        state.held = std::round(juce::jlimit(-1.0f, 1.0f, input) * levels) / levels;
+    }
+    return state.held;
+}
+
+// === TruePeakLimiter Implementation ===
+
+void DualCoreDSP::TruePeakLimiter::prepare(double sr)
+{
+    windowLength = juce::jmax(1, static_cast<int>(std::round(sr * LIMITER_LOOKAHEAD_MS * 0.001)));
+
+    // Audio delay covers the hold window plus the interpolator's group delay
+    delay.prepare(getLatencySamples());
+    delay.setDelay(getLatencySamples());
+
+    // Window is one longer than the box so both samples around each
+    // interpolated peak are covered
+    peakValues.assign(static_cast<size_t>(windowLength + 2), 0.0f);
+    peakTimes.assign(static_cast<size_t>(windowLength + 2), 0u);
+    boxBuffer.assign(static_cast<size_t>(windowLength), 1.0f);
+
+    releaseCoef = std::exp(-1.0f / (static_cast<float>(sr) * LIMITER_RELEASE_MS * 0.001f));
+    reset();
+}
+
+void DualCoreDSP::TruePeakLimiter::setCeiling(float ceilingDb)
+{
+    ceiling = juce::Decibels::decibelsToGain(juce::jlimit(-24.0f, 0.0f, ceilingDb));
+}
+
+void DualCoreDSP::TruePeakLimiter::reset()
+{
+    delay.reset();
+    dequeFront = 0;
+    dequeCount = 0;
+    time = 0;
+    std::fill(boxBuffer.begin(), boxBuffer.end(), 1.0f);
+    boxSum = static_cast<double>(boxBuffer.size());
+    boxIndex = 0;
+    for (auto& h : history)
+        h = 0.0f;
+    historyIndex = 0;
+    gainEnvelope = 1.0f;
+}
+
+float DualCoreDSP::TruePeakLimiter::detectTruePeak(float input)
+{
+    static_assert(TruePeakInterpolator::taps == INTERP_TAPS, "Interpolator and limiter history must match");
+
+    if (!std::isfinite(input)) input = 0.0f;
+
+    history[historyIndex] = input;
+    historyIndex = (historyIndex + 1) % INTERP_TAPS;
+
+    // Sample peak at the interpolator centre plus the 4 interpolated positions
+    float peak = std::abs(history[(historyIndex + INTERP_TAPS / 2 - 1) % INTERP_TAPS]);
+
+    for (int phase = 0; phase < TruePeakInterpolator::phases; ++phase)
+    {
+        const float* coeffs = truePeakInterpolator.coefficients[phase];
+        float sum = 0.0f;
+        for (int tap = 0; tap < INTERP_TAPS; ++tap)
+        {
+            // Newest sample first
+            int index = historyIndex - 1 - tap;
+            if (index < 0)
+                index += INTERP_TAPS;
+            sum += history[index] * coeffs[tap];
+        }
+        peak = juce::jmax(peak, std::abs(sum));
+    }
+
+    return peak;
+}
+
+float DualCoreDSP::TruePeakLimiter::slidingMax(float peak)
+{
+    const int capacity = static_cast<int>(peakValues.size());
+
+    // Drop smaller values from the back; they can never be the maximum again
+    while (dequeCount > 0)
+    {
+        int back = (dequeFront + dequeCount - 1) % capacity;
+        if (peakValues[static_cast<size_t>(back)] > peak)
+            break;
+        --dequeCount;
+    }
+
+    int back = (dequeFront + dequeCount) % capacity;
+    peakValues[static_cast<size_t>(back)] = peak;
+    peakTimes[static_cast<size_t>(back)] = time;
+    ++dequeCount;
+
+    // Expire the front once it leaves the window (window + 1, see prepare())
+    while (time - peakTimes[static_cast<size_t>(dequeFront)] > static_cast<uint32_t>(windowLength))
+    {
+        dequeFront = (dequeFront + 1) % capacity;
+        --dequeCount;
+    }
+
+    ++time;
+    return peakValues[static_cast<size_t>(dequeFront)];
+}
+
+float DualCoreDSP::TruePeakLimiter::process(float input)
+{
+    float peak = slidingMax(detectTruePeak(input));
+
+    // Instant attack to the required gain, smooth release
+    float targetGain = peak > ceiling ? ceiling / peak : 1.0f;
+    if (targetGain < gainEnvelope)
+        gainEnvelope = targetGain;
+    else
+        gainEnvelope = targetGain + releaseCoef * (gainEnvelope - targetGain);
+
+    // Boxcar over the window length: gain ramps down across the lookahead and
+    // never exceeds the held target at the peak's output time
+    boxSum += static_cast<double>(gainEnvelope) - static_cast<double>(boxBuffer[static_cast<size_t>(boxIndex)]);
+    boxBuffer[static_cast<size_t>(boxIndex)] = gainEnvelope;
+    if (++boxIndex >= static_cast<int>(boxBuffer.size()))
+        boxIndex = 0;
 
-    float overThreshold = absInput - threshold;
-    float compressed = threshold + knee * std::tanh(overThreshold / knee);
-    return (input > 0.0f) ? compressed : -compressed;
+    float gain = static_cast<float>(boxSum / static_cast<double>(boxBuffer.size()));
+    float output = delay.process(input) * gain;
+
+    // Guard against rounding in the running sum
+    return juce::jlimit(-ceiling, ceiling, output);
 }
 
 // === SVFilter Implementation ===
@@ -758,7 +2959,7 @@ void DualCoreDSP::SVFilter::updateCoefficients(double sr)
     if (sr <= 0.0) sr = 44100.0;
 
     // Base SVF coefficients (used by SVF and as basis for others)
-    f = 2.0f * std::sin(juce::MathConstants<float>::pi * frequency / static_cast<float>(sr));
+    f = svfFrequencyCoefficient(frequency / static_cast<float>(sr));
     f = juce::jlimit(0.0f, 0.99f, f);
     q = 1.0f - resonance * 0.99f;
     q = juce::jmax(0.01f, q);
@@ -802,32 +3003,18 @@ void DualCoreDSP::SVFilter::reset()
     }
     // MS-20/Steiner state
     s1 = s2 = 0.0f;
+    taps = {};
 }
 
-// === Saturation helper functions ===
-
-float DualCoreDSP::SVFilter::tanhApprox(float x)
+void DualCoreDSP::SVFilter::setMorphPosition(float position)
 {
-    // Fast tanh approximation
-    if (x < -3.0f) return -1.0f;
-    if (x > 3.0f) return 1.0f;
-    float x2 = x * x;
-    return x * (27.0f + x2) / (27.0f + 9.0f * x2);
-}
+    if (position == morphPosition)
+        return;
 
-float DualCoreDSP::SVFilter::softClip(float x)
-{
-    // Soft saturation curve
-    return x / (1.0f + std::abs(x));
-}
+    morphPosition = position;
 
-float DualCoreDSP::SVFilter::diodeClip(float x)
-{
-    // Asymmetric diode-style clipping (sharper than tanh)
-    if (x > 0.0f)
-        return 1.0f - std::exp(-x * 1.5f);
-    else
-        return -1.0f + std::exp(x * 1.2f);
+    // Weights are only recomputed here, so the per-sample output is a branch-free weighted sum
+    computeTapGains(position, tapGains);
 }
 
 // === Clean SVF (Chamberlin) ===
@@ -851,14 +3038,11 @@ float DualCoreDSP::SVFilter::processSVF(float input)
     if (!std::isfinite(bandpass)) bandpass = 0.0f;
     if (!std::isfinite(highpass)) highpass = 0.0f;
 
-    switch (mode)
-    {
-        case FilterMode::LowPass:  return lowpass;
-        case FilterMode::HighPass: return highpass;
-        case FilterMode::BandPass: return bandpass;
-        case FilterMode::Notch:    return notch;
-        default: return lowpass;
-    }
+    taps.lowpass = lowpass;
+    taps.bandpass = bandpass;
+    taps.highpass = highpass;
+    taps.notch = notch;
+    return mixTaps();
 }
 
 // === Moog-style Transistor Ladder ===
@@ -898,20 +3082,12 @@ float DualCoreDSP::SVFilter::processLadder(float input)
         delay[i] = stage[i];
     }
 
-    // Output selection based on mode
-    switch (mode)
-    {
-        case FilterMode::LowPass:
-            return stage[3];  // 4-pole lowpass (24dB/oct)
-        case FilterMode::HighPass:
-            return input - stage[3];  // Highpass by subtraction
-        case FilterMode::BandPass:
-            return stage[1] - stage[3];  // Bandpass from stages
-        case FilterMode::Notch:
-            return input - stage[1] + stage[3] * 0.5f;  // Notch approximation
-        default:
-            return stage[3];
-    }
+    // All outputs from the same pass
+    taps.lowpass = stage[3];                           // 4-pole lowpass (24dB/oct)
+    taps.highpass = input - stage[3];                  // Highpass by subtraction
+    taps.bandpass = stage[1] - stage[3];               // Bandpass from stages
+    taps.notch = input - stage[1] + stage[3] * 0.5f;   // Notch approximation
+    return mixTaps();
 }
 
 // === Diode Ladder (303-style) ===
@@ -953,19 +3129,11 @@ float DualCoreDSP::SVFilter::processDiode(float input)
     // Compensate for bass loss less than Moog
     float bassComp = 1.0f + k * 0.15f;
 
-    switch (mode)
-    {
-        case FilterMode::LowPass:
-            return stage[3] * bassComp;
-        case FilterMode::HighPass:
-            return (input - stage[3]) * bassComp;
-        case FilterMode::BandPass:
-            return (stage[1] - stage[3]) * bassComp * 1.5f;
-        case FilterMode::Notch:
-            return (input - stage[1] + stage[3] * 0.5f) * bassComp;
-        default:
-            return stage[3] * bassComp;
-    }
+    taps.lowpass = stage[3] * bassComp;
+    taps.highpass = (input - stage[3]) * bassComp;
+    taps.bandpass = (stage[1] - stage[3]) * bassComp * 1.5f;
+    taps.notch = (input - stage[1] + stage[3] * 0.5f) * bassComp;
+    return mixTaps();
 }
 
 // === Korg MS-20 Style ===
@@ -1009,23 +3177,14 @@ float DualCoreDSP::SVFilter::processMS20(float input)
     }
 
     // Safety limits
-    if (!std::isfinite(s1)) s1 = 0.0f;
-    if (!std::isfinite(s2)) s2 = 0.0f;
-
-    // Output selection
-    switch (mode)
-    {
-        case FilterMode::LowPass:
-            return s2;
-        case FilterMode::HighPass:
-            return hp1;
-        case FilterMode::BandPass:
-            return s1 - s2;
-        case FilterMode::Notch:
-            return hp1 + s2 * 0.7f;
-        default:
-            return s2;
-    }
+    if (!std::isfinite(s1)) s1 = 0.0f;
+    if (!std::isfinite(s2)) s2 = 0.0f;
+
+    taps.lowpass = s2;
+    taps.highpass = hp1;
+    taps.bandpass = s1 - s2;
+    taps.notch = hp1 + s2 * 0.7f;
+    return mixTaps();
 }
 
 // === Steiner-Parker ===
@@ -1062,19 +3221,11 @@ float DualCoreDSP::SVFilter::processSteiner(float input)
     // Add subtle formant emphasis
     float formant = s1 * s2 * 0.1f;  // Intermodulation for vocal quality
 
-    switch (mode)
-    {
-        case FilterMode::LowPass:
-            return s2 + formant;
-        case FilterMode::HighPass:
-            return inputWithFB - s1 + formant * 0.5f;
-        case FilterMode::BandPass:
-            return (s1 - s2) * 1.3f + formant;
-        case FilterMode::Notch:
-            return inputWithFB - s1 + s2 + formant * 0.3f;
-        default:
-            return s2 + formant;
-    }
+    taps.lowpass = s2 + formant;
+    taps.highpass = inputWithFB - s1 + formant * 0.5f;
+    taps.bandpass = (s1 - s2) * 1.3f + formant;
+    taps.notch = inputWithFB - s1 + s2 + formant * 0.3f;
+    return mixTaps();
 }
 
 // === OTA (80s Polysynth style) ===
@@ -1112,18 +3263,206 @@ float DualCoreDSP::SVFilter::processOTA(float input)
     if (!std::isfinite(s1)) s1 = 0.0f;
     if (!std::isfinite(s2)) s2 = 0.0f;
 
-    switch (mode)
+    taps.lowpass = s2;
+    taps.highpass = inputWithFB - s1;
+    taps.bandpass = (s1 - s2) * 1.4f;  // Boosted bandpass
+    taps.notch = inputWithFB - s1 + s2;
+    return mixTaps();
+}
+
+// === FilterLanes Implementation ===
+// Each core is the SVFilter version with one lane per loop iteration
+
+void DualCoreDSP::FilterLanes::updateCoefficients(double sr)
+{
+    if (sr <= 0.0) sr = 44100.0;
+    const float invSampleRate = 1.0f / static_cast<float>(sr);
+
+    for (int lane = 0; lane < LANES; ++lane)
     {
-        case FilterMode::LowPass:
-            return s2;
-        case FilterMode::HighPass:
-            return inputWithFB - s1;
-        case FilterMode::BandPass:
-            return (s1 - s2) * 1.4f;  // Boosted bandpass
-        case FilterMode::Notch:
-            return inputWithFB - s1 + s2;
-        default:
-            return s2;
+        float fc = frequency[lane] * invSampleRate;
+        f[lane] = juce::jlimit(0.0f, 0.99f, svfFrequencyCoefficient(fc));
+        q[lane] = juce::jmax(0.01f, 1.0f - resonance[lane] * 0.99f);
+
+        float gain = 0.9892f * fc - 0.4342f * fc * fc + 0.1381f * fc * fc * fc - 0.0202f * fc * fc * fc * fc;
+        g[lane] = juce::jlimit(0.0f, 0.9f, gain);
+        k[lane] = resonance[lane] * 4.0f;
+    }
+}
+
+void DualCoreDSP::FilterLanes::process(const float* input)
+{
+    switch (type)
+    {
+        case FilterType::SVF:     processSVF(input); break;
+        case FilterType::Ladder:  processLadder(input); break;
+        case FilterType::Diode:   processDiode(input); break;
+        case FilterType::MS20:    processMS20(input); break;
+        case FilterType::Steiner: processSteiner(input); break;
+        case FilterType::OTA:     processOTA(input); break;
+        default: processSVF(input); break;
+    }
+
+    mixTaps();
+}
+
+void DualCoreDSP::FilterLanes::reset()
+{
+    for (int lane = 0; lane < LANES; ++lane)
+    {
+        lowpass[lane] = bandpass[lane] = 0.0f;
+        stage[0][lane] = stage[1][lane] = stage[2][lane] = stage[3][lane] = 0.0f;
+        s1[lane] = s2[lane] = 0.0f;
+        tapLowpass[lane] = tapBandpass[lane] = tapHighpass[lane] = tapNotch[lane] = 0.0f;
+        output[lane] = 0.0f;
+    }
+}
+
+void DualCoreDSP::FilterLanes::mixTaps()
+{
+    for (int lane = 0; lane < LANES; ++lane)
+        output[lane] = tapLowpass[lane] * tapGains[0] + tapBandpass[lane] * tapGains[1]
+                     + tapHighpass[lane] * tapGains[2] + tapNotch[lane] * tapGains[3];
+}
+
+void DualCoreDSP::FilterLanes::processSVF(const float* input)
+{
+    for (int lane = 0; lane < LANES; ++lane)
+    {
+        float lp = lowpass[lane] + f[lane] * bandpass[lane];
+        float hp = input[lane] - lp - q[lane] * bandpass[lane];
+        float bp = bandpass[lane] + f[lane] * hp;
+        tapNotch[lane] = hp + lp;
+
+        bp = juce::jlimit(-4.0f, 4.0f, bp);
+        lp = juce::jlimit(-4.0f, 4.0f, lp);
+
+        lowpass[lane] = std::isfinite(lp) ? lp : 0.0f;
+        bandpass[lane] = std::isfinite(bp) ? bp : 0.0f;
+        tapHighpass[lane] = std::isfinite(hp) ? hp : 0.0f;
+        tapLowpass[lane] = lowpass[lane];
+        tapBandpass[lane] = bandpass[lane];
+    }
+}
+
+void DualCoreDSP::FilterLanes::processLadder(const float* input)
+{
+    for (int lane = 0; lane < LANES; ++lane)
+    {
+        float x = tanhApprox(input[lane] - stage[3][lane] * k[lane]);
+
+        float a = tanhApprox(stage[0][lane] + g[lane] * (x - stage[0][lane]));
+        float b = tanhApprox(stage[1][lane] + g[lane] * (a - stage[1][lane]));
+        float c = tanhApprox(stage[2][lane] + g[lane] * (b - stage[2][lane]));
+        float d = tanhApprox(stage[3][lane] + g[lane] * (c - stage[3][lane]));
+
+        stage[0][lane] = a = std::isfinite(a) ? a : 0.0f;
+        stage[1][lane] = b = std::isfinite(b) ? b : 0.0f;
+        stage[2][lane] = c = std::isfinite(c) ? c : 0.0f;
+        stage[3][lane] = d = std::isfinite(d) ? d : 0.0f;
+
+        tapLowpass[lane] = d;
+        tapHighpass[lane] = input[lane] - d;
+        tapBandpass[lane] = b - d;
+        tapNotch[lane] = input[lane] - b + d * 0.5f;
+    }
+}
+
+void DualCoreDSP::FilterLanes::processDiode(const float* input)
+{
+    for (int lane = 0; lane < LANES; ++lane)
+    {
+        float x = diodeClip((input[lane] - stage[3][lane] * k[lane] * 1.1f) * 1.2f);
+
+        float a = diodeClip(stage[0][lane] + g[lane] * (x - stage[0][lane]));
+        float b = diodeClip(stage[1][lane] + g[lane] * (a - stage[1][lane]));
+        float c = diodeClip(stage[2][lane] + g[lane] * (b - stage[2][lane]));
+        float d = diodeClip(stage[3][lane] + g[lane] * (c - stage[3][lane]));
+
+        stage[0][lane] = a = std::isfinite(a) ? a : 0.0f;
+        stage[1][lane] = b = std::isfinite(b) ? b : 0.0f;
+        stage[2][lane] = c = std::isfinite(c) ? c : 0.0f;
+        stage[3][lane] = d = std::isfinite(d) ? d : 0.0f;
+
+        float bassComp = 1.0f + k[lane] * 0.15f;
+        tapLowpass[lane] = d * bassComp;
+        tapHighpass[lane] = (input[lane] - d) * bassComp;
+        tapBandpass[lane] = (b - d) * bassComp * 1.5f;
+        tapNotch[lane] = (input[lane] - b + d * 0.5f) * bassComp;
+    }
+}
+
+void DualCoreDSP::FilterLanes::processMS20(const float* input)
+{
+    for (int lane = 0; lane < LANES; ++lane)
+    {
+        const float reso = resonance[lane];
+        float fb = s2[lane] * reso * reso * 4.0f;
+        fb = fb > 0.0f ? std::tanh(fb * 2.0f) : std::tanh(fb * 1.5f);
+
+        float inputWithFB = input[lane] - fb;
+
+        float hp1 = inputWithFB - s1[lane];
+        float a = tanhApprox((s1[lane] + f[lane] * hp1) * 1.3f);
+        float b = s2[lane] + f[lane] * (a - s2[lane]);
+
+        if (reso > 0.7f)
+            b = std::sin(juce::jlimit(-3.0f, 3.0f, b * (1.0f + (reso - 0.7f) * 3.0f)));
+        else
+            b = tanhApprox(b * 1.5f);
+
+        s1[lane] = a = std::isfinite(a) ? a : 0.0f;
+        s2[lane] = b = std::isfinite(b) ? b : 0.0f;
+
+        tapLowpass[lane] = b;
+        tapHighpass[lane] = hp1;
+        tapBandpass[lane] = a - b;
+        tapNotch[lane] = hp1 + b * 0.7f;
+    }
+}
+
+void DualCoreDSP::FilterLanes::processSteiner(const float* input)
+{
+    for (int lane = 0; lane < LANES; ++lane)
+    {
+        float fb = softClip(s2[lane] * resonance[lane] * 3.5f * (1.0f + s2[lane] * 0.3f));
+        float inputWithFB = input[lane] - fb;
+
+        float a = s1[lane] + f[lane] * softClip((inputWithFB - s1[lane]) * 1.5f);
+        float b = s2[lane] + f[lane] * 0.95f * softClip((a - s2[lane]) * 1.3f);
+
+        s1[lane] = a = std::isfinite(a) ? a : 0.0f;
+        s2[lane] = b = std::isfinite(b) ? b : 0.0f;
+
+        float formant = a * b * 0.1f;
+        tapLowpass[lane] = b + formant;
+        tapHighpass[lane] = inputWithFB - a + formant * 0.5f;
+        tapBandpass[lane] = (a - b) * 1.3f + formant;
+        tapNotch[lane] = inputWithFB - a + b + formant * 0.3f;
+    }
+}
+
+void DualCoreDSP::FilterLanes::processOTA(const float* input)
+{
+    for (int lane = 0; lane < LANES; ++lane)
+    {
+        const float reso = resonance[lane];
+        float grain = juce::jmax(0.0f, reso - 0.5f) * 0.02f * (s2[lane] * s2[lane]);
+        float fb = tanhApprox(s2[lane] * reso * 3.8f) + grain;
+
+        float inputWithFB = input[lane] - fb;
+        float attackMod = 1.0f + std::abs(inputWithFB) * 0.2f;
+
+        float a = s1[lane] + f[lane] * attackMod * tanhApprox((inputWithFB - s1[lane]) * 1.2f);
+        float b = s2[lane] + f[lane] * tanhApprox((a - s2[lane]) * 1.1f);
+
+        s1[lane] = a = std::isfinite(a) ? a : 0.0f;
+        s2[lane] = b = std::isfinite(b) ? b : 0.0f;
+
+        tapLowpass[lane] = b;
+        tapHighpass[lane] = inputWithFB - a;
+        tapBandpass[lane] = (a - b) * 1.4f;
+        tapNotch[lane] = inputWithFB - a + b;
     }
 }
 
@@ -1210,55 +3549,226 @@ void DualCoreDSP::ADSREnvelope::reset()
     output = 0.0f;
 }
 
+// === Poly Voice Pool Implementation ===
+
+void DualCoreDSP::PolyVoicePool::noteOn(int noteNumber, float noteVelocity)
+{
+    // Note-on always (re)starts the attack from the current level, so stolen voices don't click
+    const int voice = findVoice(noteNumber);
+    note[voice] = noteNumber;
+    velocity[voice] = noteVelocity;
+    keyOctaves[voice] = static_cast<float>(noteNumber - 60) / 12.0f;
+    stage[voice] = Attack;
+    startTime[voice] = ++clock;
+}
+
+void DualCoreDSP::PolyVoicePool::noteOff(int noteNumber)
+{
+    for (int voice = 0; voice < VOICES; ++voice)
+        if (note[voice] == noteNumber && stage[voice] != Idle && stage[voice] != Release)
+            stage[voice] = Release;
+}
+
+void DualCoreDSP::PolyVoicePool::releaseAll()
+{
+    for (int voice = 0; voice < VOICES; ++voice)
+        if (stage[voice] != Idle)
+            stage[voice] = Release;
+}
+
+int DualCoreDSP::PolyVoicePool::findVoice(int noteNumber) const
+{
+    // Retrigger a voice already playing this note
+    for (int voice = 0; voice < VOICES; ++voice)
+        if (stage[voice] != Idle && note[voice] == noteNumber)
+            return voice;
+
+    for (int voice = 0; voice < VOICES; ++voice)
+        if (stage[voice] == Idle)
+            return voice;
+
+    // Steal the oldest releasing voice, otherwise the oldest voice
+    int oldest = -1;
+    for (int voice = 0; voice < VOICES; ++voice)
+        if (stage[voice] == Release && (oldest < 0 || startTime[voice] < startTime[oldest]))
+            oldest = voice;
+
+    if (oldest >= 0)
+        return oldest;
+
+    oldest = 0;
+    for (int voice = 1; voice < VOICES; ++voice)
+        if (startTime[voice] < startTime[oldest])
+            oldest = voice;
+
+    return oldest;
+}
+
+void DualCoreDSP::PolyVoicePool::advance(const ADSREnvelope& settings)
+{
+    // Same segments as ADSREnvelope::process(), one lane per voice
+    for (int voice = 0; voice < VOICES; ++voice)
+    {
+        float out = level[voice];
+
+        switch (stage[voice])
+        {
+            case Attack:
+                out += settings.attackRate;
+                if (out >= 1.0f)
+                {
+                    out = 1.0f;
+                    stage[voice] = Decay;
+                }
+                break;
+
+            case Decay:
+                out -= settings.decayRate;
+                if (out <= settings.sustainLevel)
+                {
+                    out = settings.sustainLevel;
+                    stage[voice] = Sustain;
+                }
+                break;
+
+            case Sustain:
+                out = settings.sustainLevel;
+                break;
+
+            case Release:
+                out -= settings.releaseRate;
+                if (out <= 0.0f)
+                {
+                    out = 0.0f;
+                    stage[voice] = Idle;
+                }
+                break;
+
+            case Idle:
+            default:
+                out = 0.0f;
+                break;
+        }
+
+        level[voice] = out;
+    }
+
+    for (int voice = 0; voice < VOICES; ++voice)
+        gain[voice] = level[voice] * velocity[voice];
+}
+
+void DualCoreDSP::PolyVoicePool::reset()
+{
+    for (int voice = 0; voice < VOICES; ++voice)
+    {
+        stage[voice] = Idle;
+        level[voice] = velocity[voice] = keyOctaves[voice] = gain[voice] = 0.0f;
+        note[voice] = -1;
+        startTime[voice] = 0;
+    }
+    clock = 0;
+}
+
 // === LFO Implementation ===
 
 void DualCoreDSP::LFO::setRate(float hz, double sr)
 {
+    rate = hz;
+    sampleRate = sr;
     phaseIncrement = hz / static_cast<float>(sr);
 }
 
-float DualCoreDSP::LFO::process()
+void DualCoreDSP::LFO::render(float* output, int numSamples, float rateMod)
 {
-    float output = 0.0f;
+    // Audio rate: matrix rate modulation is +/-2 octaves (modValue * 10 Hz arrives here),
+    // capped below Nyquist so the PolyBLEP residuals stay two samples wide
+    const float sr = static_cast<float>(sampleRate);
+    const float hz = audioRate > 0.0f
+        ? juce::jlimit(0.01f, sr * 0.45f, audioRate * fastExp2(rateMod * 0.2f))
+        : juce::jlimit(0.01f, 20.0f, rate + rateMod);
+    phaseIncrement = hz / sr;
+    const float dt = phaseIncrement;
 
     switch (waveform)
     {
         case LFOWaveform::Sine:
-            output = std::sin(phase * juce::MathConstants<float>::twoPi);
+        {
+            // Rotating phasor, re-seeded from the phase every block so it never drifts
+            const float angle = phase * juce::MathConstants<float>::twoPi;
+            const float step = dt * juce::MathConstants<float>::twoPi;
+            const float stepCos = std::cos(step);
+            const float stepSin = std::sin(step);
+            float s = std::sin(angle);
+            float c = std::cos(angle);
+
+            for (int i = 0; i < numSamples; ++i)
+            {
+                output[i] = s;
+                const float nextS = s * stepCos + c * stepSin;
+                c = c * stepCos - s * stepSin;
+                s = nextS;
+            }
             break;
+        }
 
         case LFOWaveform::Triangle:
-            output = 4.0f * std::abs(phase - 0.5f) - 1.0f;
-            break;
+            for (int i = 0; i < numSamples; ++i)
+            {
+                output[i] = 4.0f * std::abs(phase - 0.5f) - 1.0f;
+                phase += dt;
+                phase -= std::floor(phase);
+            }
+            return;
 
         case LFOWaveform::Square:
-            output = (phase < 0.5f) ? 1.0f : -1.0f;
-            break;
+            for (int i = 0; i < numSamples; ++i)
+            {
+                float falling = phase + 0.5f;
+                falling -= std::floor(falling);
+                output[i] = ((phase < 0.5f) ? 1.0f : -1.0f) + polyBLEP(phase, dt) - polyBLEP(falling, dt);
+                phase += dt;
+                phase -= std::floor(phase);
+            }
+            return;
 
         case LFOWaveform::SawUp:
-            output = 2.0f * phase - 1.0f;
-            break;
-
         case LFOWaveform::SawDown:
-            output = 1.0f - 2.0f * phase;
-            break;
+        {
+            const float direction = (waveform == LFOWaveform::SawUp) ? 1.0f : -1.0f;
+            for (int i = 0; i < numSamples; ++i)
+            {
+                output[i] = direction * (2.0f * phase - 1.0f - polyBLEP(phase, dt));
+                phase += dt;
+                phase -= std::floor(phase);
+            }
+            return;
+        }
 
         case LFOWaveform::Random:
-            if (phase < phaseIncrement)
+            for (int i = 0; i < numSamples; ++i)
             {
-                lastRandomValue = randomValue;
-                randomValue = (static_cast<float>(rand()) / RAND_MAX) * 2.0f - 1.0f;
+                if (phase < dt)
+                {
+                    lastRandomValue = randomValue;
+                    randomValue = (static_cast<float>(rand()) / RAND_MAX) * 2.0f - 1.0f;
+                }
+                // Smooth interpolation
+                output[i] = lastRandomValue + phase * (randomValue - lastRandomValue);
+                phase += dt;
+                phase -= std::floor(phase);
             }
-            // Smooth interpolation
-            output = lastRandomValue + phase * (randomValue - lastRandomValue);
-            break;
+            return;
     }
 
-    phase += phaseIncrement;
-    if (phase >= 1.0f)
-        phase -= 1.0f;
+    // Sine: advance the phase for the whole block
+    phase += dt * static_cast<float>(numSamples);
+    phase -= std::floor(phase);
+}
 
-    return output;
+void DualCoreDSP::LFO::retrigger()
+{
+    // Waveforms start at phase 0; Random keeps its current segment values
+    phase = 0.0f;
 }
 
 void DualCoreDSP::LFO::reset()
@@ -1297,44 +3807,426 @@ void DualCoreDSP::EnvelopeFollower::reset()
     envelope = 0.0f;
 }
 
-// === ShelfFilter Implementation ===
+// === AnalogDrift Implementation ===
+
+void DualCoreDSP::AnalogDrift::seed(uint32_t newSeed)
+{
+    rng = newSeed != 0 ? newSeed : 1;  // xorshift sticks at zero
+    for (auto& offset : tolerance)
+        offset = nextRandom();
+    for (auto& state : walk)
+        state = nextRandom() * 1.7320508f;  // Start inside the walk's spread (uniform, unit variance)
+    value.fill(0.0f);
+    step.fill(0.0f);
+}
+
+float DualCoreDSP::AnalogDrift::nextRandom()
+{
+    rng ^= rng << 13;
+    rng ^= rng >> 17;
+    rng ^= rng << 5;
+    return static_cast<float>(rng) * (2.0f / 4294967296.0f) - 1.0f;
+}
+
+void DualCoreDSP::AnalogDrift::update(float amount, float walkDecay, float walkNoise)
+{
+    // Full-amount ranges: tolerance +/-0.1 octave, +/-0.05 resonance, +/-15% drive;
+    // wander (one standard deviation) 0.04 octave, 0.015 resonance, 5% drive
+    constexpr std::array<float, NUM_TARGETS> toleranceRange = {0.1f, 0.05f, 0.15f};
+    constexpr std::array<float, NUM_TARGETS> walkRange = {0.04f, 0.015f, 0.05f};
+
+    for (size_t i = 0; i < value.size(); ++i)
+    {
+        walk[i] += nextRandom() * walkNoise - walk[i] * walkDecay;
+        const float target = amount * (tolerance[i] * toleranceRange[i] + walk[i] * walkRange[i]);
+        step[i] = (target - value[i]) * (1.0f / static_cast<float>(DRIFT_INTERVAL));
+    }
+}
+
+// === SpectralFollower Implementation ===
 
-void DualCoreDSP::ShelfFilter::setHighShelf(float freqHz, float gainDb, double sr)
+void DualCoreDSP::SpectralFollower::prepare(double sampleRate)
 {
-    float A = std::pow(10.0f, gainDb / 40.0f);
-    float w0 = juce::MathConstants<float>::twoPi * freqHz / static_cast<float>(sr);
-    float cosw0 = std::cos(w0);
-    float alpha = std::sin(w0) / 2.0f * std::sqrt(2.0f);
+    // Split down until the residue is below ~200 Hz. Level k measures sr/2^(k+2) to
+    // sr/2^(k+1) and runs at sr/2^(k+1)
+    constexpr float timeConstant = 0.03f;  // 30 ms power smoothing at every level
+    numLevels = juce::jlimit(1, MAX_LEVELS, static_cast<int>(std::ceil(std::log2(sampleRate / 400.0))));
+
+    for (int level = 0; level <= numLevels; ++level)
+    {
+        const bool residue = level == numLevels;
+        const double levelRate = sampleRate / std::exp2(residue ? level : level + 1);
+        const auto index = static_cast<size_t>(level);
+        powerCoef[index] = 1.0f - std::exp(-1.0f / (timeConstant * static_cast<float>(levelRate)));
+
+        const double top = sampleRate / std::exp2(level + 1);
+        const double centre = residue ? top * 0.5 : top * juce::MathConstants<double>::sqrt2 * 0.5;
+        octave[index] = static_cast<float>(std::log2(centre));
+        band[index] = centre < 300.0 ? 0 : (centre < 3000.0 ? 1 : 2);
+    }
+    reset();
+}
+
+void DualCoreDSP::SpectralFollower::process(float* signal, int numSamples)
+{
+    if (numSamples <= 0)
+        return;
+
+    // Each level pairs samples in place: sums feed the next level at half the rate,
+    // differences are this level's octave band. An odd sample waits for the next block
+    int count = numSamples;
+    for (int level = 0; level < numLevels; ++level)
+    {
+        const auto index = static_cast<size_t>(level);
+        float levelPower = power[index];
+        const float coef = powerCoef[index];
+        int in = 0;
+        int out = 0;
+
+        auto split = [&](float a, float b)
+        {
+            const float difference = (a - b) * 0.5f;
+            levelPower += (difference * difference - levelPower) * coef;
+            signal[out++] = (a + b) * 0.5f;
+        };
+
+        if (hasPending[index] && count > 0)
+            split(pending[index], signal[in++]);
+        for (; in + 1 < count; in += 2)
+            split(signal[in], signal[in + 1]);
+
+        hasPending[index] = in < count;
+        if (hasPending[index])
+            pending[index] = signal[in];
+
+        power[index] = levelPower;
+        count = out;
+    }
+
+    auto& residuePower = power[static_cast<size_t>(numLevels)];
+    const float residueCoef = powerCoef[static_cast<size_t>(numLevels)];
+    for (int i = 0; i < count; ++i)
+        residuePower += (signal[i] * signal[i] - residuePower) * residueCoef;
+
+    // Haar levels partition the input power, so band power is a plain sum
+    std::array<float, 3> bandPower = {};
+    float totalPower = 0.0f;
+    float weightedOctave = 0.0f;
+    for (int level = 0; level <= numLevels; ++level)
+    {
+        const auto index = static_cast<size_t>(level);
+        bandPower[static_cast<size_t>(band[index])] += power[index];
+        totalPower += power[index];
+        weightedOctave += power[index] * octave[index];
+    }
 
-    float norm = (A + 1.0f) - (A - 1.0f) * cosw0 + 2.0f * std::sqrt(A) * alpha;
+    // Bands as RMS (a full-scale sine reads 1); brightness spans 100 Hz to 10 kHz and
+    // holds its last value through silence
+    for (size_t b = 0; b < bandPower.size(); ++b)
+        outputTarget[b] = juce::jmin(1.0f, std::sqrt(bandPower[b] * 2.0f)) * 2.0f - 1.0f;
 
-    a0 = (A * ((A + 1.0f) + (A - 1.0f) * cosw0 + 2.0f * std::sqrt(A) * alpha)) / norm;
-    a1 = (-2.0f * A * ((A - 1.0f) + (A + 1.0f) * cosw0)) / norm;
-    b1 = ((A + 1.0f) - (A - 1.0f) * cosw0 - 2.0f * std::sqrt(A) * alpha) / norm;
+    if (totalPower > 1.0e-8f)  // -80 dB
+    {
+        const float lowOctave = std::log2(100.0f);
+        const float brightness = (weightedOctave / totalPower - lowOctave) / (std::log2(10000.0f) - lowOctave);
+        outputTarget[3] = juce::jlimit(0.0f, 1.0f, brightness) * 2.0f - 1.0f;
+    }
+
+    // Ramp from where the last block ended
+    for (size_t i = 0; i < outputTarget.size(); ++i)
+    {
+        output[i] += outputStep[i] * static_cast<float>(rampLength);
+        outputStep[i] = (outputTarget[i] - output[i]) / static_cast<float>(numSamples);
+    }
+    rampLength = numSamples;
 }
 
-void DualCoreDSP::ShelfFilter::setLowShelf(float freqHz, float gainDb, double sr)
+void DualCoreDSP::SpectralFollower::reset()
 {
-    float A = std::pow(10.0f, gainDb / 40.0f);
-    float w0 = juce::MathConstants<float>::twoPi * freqHz / static_cast<float>(sr);
-    float cosw0 = std::cos(w0);
-    float alpha = std::sin(w0) / 2.0f * std::sqrt(2.0f);
+    power.fill(0.0f);
+    pending.fill(0.0f);
+    hasPending.fill(false);
+    output.fill(-1.0f);
+    outputTarget.fill(-1.0f);
+    outputStep.fill(0.0f);
+    rampLength = 0;
+}
 
-    float norm = (A + 1.0f) + (A - 1.0f) * cosw0 + 2.0f * std::sqrt(A) * alpha;
+// === DelayLine Implementation ===
 
-    a0 = (A * ((A + 1.0f) - (A - 1.0f) * cosw0 + 2.0f * std::sqrt(A) * alpha)) / norm;
-    a1 = (2.0f * A * ((A - 1.0f) - (A + 1.0f) * cosw0)) / norm;
-    b1 = ((A + 1.0f) + (A - 1.0f) * cosw0 - 2.0f * std::sqrt(A) * alpha) / norm;
+void DualCoreDSP::DelayLine::prepare(int maxDelaySamples)
+{
+    buffer.assign(static_cast<size_t>(juce::jmax(0, maxDelaySamples) + 1), 0.0f);
+    writeIndex = 0;
+    delaySamples = juce::jmin(delaySamples, maxDelaySamples);
 }
 
-float DualCoreDSP::ShelfFilter::process(float input)
+void DualCoreDSP::DelayLine::setDelay(int samples)
 {
-    float output = a0 * input + z1;
-    z1 = a1 * input - b1 * output;
-    return output;
+    delaySamples = juce::jlimit(0, juce::jmax(0, static_cast<int>(buffer.size()) - 1), samples);
+}
+
+float DualCoreDSP::DelayLine::process(float input)
+{
+    const int size = static_cast<int>(buffer.size());
+    buffer[static_cast<size_t>(writeIndex)] = input;
+
+    int readIndex = writeIndex - delaySamples;
+    if (readIndex < 0)
+        readIndex += size;
+
+    if (++writeIndex >= size)
+        writeIndex = 0;
+
+    return buffer[static_cast<size_t>(readIndex)];
+}
+
+void DualCoreDSP::DelayLine::reset()
+{
+    std::fill(buffer.begin(), buffer.end(), 0.0f);
+    writeIndex = 0;
+}
+
+// === Crossover Implementation ===
+
+void DualCoreDSP::Crossover::Section::setCutoff(float freqHz, double sr)
+{
+    const float g = std::tan(juce::MathConstants<float>::pi
+                             * juce::jlimit(10.0f, static_cast<float>(sr * 0.49), freqHz) / static_cast<float>(sr));
+    a1 = 1.0f / (1.0f + g * (g + K));
+    a2 = g * a1;
+    a3 = g * a2;
+}
+
+void DualCoreDSP::Crossover::Section::process(float input, float& lowpass, float& bandpass, float& highpass)
+{
+    const float v3 = input - ic2;
+    const float v1 = a1 * ic1 + a2 * v3;
+    const float v2 = ic2 + a2 * ic1 + a3 * v3;
+    ic1 = 2.0f * v1 - ic1;
+    ic2 = 2.0f * v2 - ic2;
+
+    lowpass = v2;
+    bandpass = v1;
+    highpass = input - K * v1 - v2;
+}
+
+float DualCoreDSP::Crossover::Section::processAllpass(float input)
+{
+    float lowpass, bandpass, highpass;
+    process(input, lowpass, bandpass, highpass);
+    return input - 2.0f * K * bandpass;
+}
+
+void DualCoreDSP::Crossover::Section::reset()
+{
+    ic1 = ic2 = 0.0f;
+}
+
+void DualCoreDSP::Crossover::configure(int bands, const std::array<float, MAX_BANDS - 1>& frequencies, double sr)
+{
+    numBands = juce::jlimit(1, MAX_BANDS, bands);
+
+    for (size_t i = 0; i < splits.size(); ++i)
+    {
+        splits[i].first.setCutoff(frequencies[i], sr);
+        splits[i].low.setCutoff(frequencies[i], sr);
+        splits[i].high.setCutoff(frequencies[i], sr);
+
+        for (auto& band : allpass)
+            band[i].setCutoff(frequencies[i], sr);
+    }
+}
+
+void DualCoreDSP::Crossover::process(float input, float* bands)
+{
+    const int numSplits = numBands - 1;
+    float rest = input;
+
+    // Peel off the lowest band at each split; what's above goes on to the next
+    for (int i = 0; i < numSplits; ++i)
+    {
+        auto& split = splits[static_cast<size_t>(i)];
+        float lowpass, bandpass, highpass, unused1, unused2;
+        split.first.process(rest, lowpass, bandpass, highpass);
+
+        float low, high;
+        split.low.process(lowpass, low, unused1, unused2);
+        split.high.process(highpass, unused1, unused2, high);
+
+        bands[i] = low;
+        rest = high;
+    }
+    bands[numSplits] = rest;
+
+    // An LR4 split sums to a 2nd-order allpass, so each lower band gets the
+    // allpass of every split above it to stay in phase with the upper bands
+    for (int band = 0; band < numSplits - 1; ++band)
+        for (int i = band + 1; i < numSplits; ++i)
+            bands[band] = allpass[static_cast<size_t>(band)][static_cast<size_t>(i)].processAllpass(bands[band]);
+}
+
+void DualCoreDSP::Crossover::reset()
+{
+    for (auto& split : splits)
+    {
+        split.first.reset();
+        split.low.reset();
+        split.high.reset();
+    }
+
+    for (auto& band : allpass)
+        for (auto& section : band)
+            section.reset();
+}
+
+// === InputEQ Implementation ===
+
+void DualCoreDSP::InputEQ::setBand(int band, float freqHz, float gainDb, float q)
+{
+    if (band < 0 || band >= NUM_EQ_BANDS)
+        return;
+
+    auto& b = bands[static_cast<size_t>(band)];
+    if (b.frequency != freqHz || b.gainDb != gainDb || b.q != q)
+    {
+        b = {freqHz, gainDb, q};
+        dirty = true;
+    }
+}
+
+void DualCoreDSP::InputEQ::setLegacyStages(bool boost, bool cut)
+{
+    if (legacyBoost != boost || legacyCut != cut)
+    {
+        legacyBoost = boost;
+        legacyCut = cut;
+        dirty = true;
+    }
+}
+
+void DualCoreDSP::InputEQ::setStage(int stage, StageShape shape, float freqHz, float gainDb, float q, double sr)
+{
+    // RBJ cookbook biquads, normalised by a0
+    const float A = std::pow(10.0f, gainDb / 40.0f);
+    const float w0 = juce::MathConstants<float>::twoPi
+                   * juce::jlimit(10.0f, 0.49f * static_cast<float>(sr), freqHz) / static_cast<float>(sr);
+    const float cosw0 = std::cos(w0);
+    const float alpha = std::sin(w0) / (2.0f * juce::jmax(0.1f, q));
+    const float sqrtA2alpha = 2.0f * std::sqrt(A) * alpha;
+
+    float nb0, nb1, nb2, na0, na1, na2;
+
+    switch (shape)
+    {
+        case StageShape::LowShelf:
+            nb0 = A * ((A + 1.0f) - (A - 1.0f) * cosw0 + sqrtA2alpha);
+            nb1 = 2.0f * A * ((A - 1.0f) - (A + 1.0f) * cosw0);
+            nb2 = A * ((A + 1.0f) - (A - 1.0f) * cosw0 - sqrtA2alpha);
+            na0 = (A + 1.0f) + (A - 1.0f) * cosw0 + sqrtA2alpha;
+            na1 = -2.0f * ((A - 1.0f) + (A + 1.0f) * cosw0);
+            na2 = (A + 1.0f) + (A - 1.0f) * cosw0 - sqrtA2alpha;
+            break;
+
+        case StageShape::HighShelf:
+            nb0 = A * ((A + 1.0f) + (A - 1.0f) * cosw0 + sqrtA2alpha);
+            nb1 = -2.0f * A * ((A - 1.0f) + (A + 1.0f) * cosw0);
+            nb2 = A * ((A + 1.0f) + (A - 1.0f) * cosw0 - sqrtA2alpha);
+            na0 = (A + 1.0f) - (A - 1.0f) * cosw0 + sqrtA2alpha;
+            na1 = 2.0f * ((A - 1.0f) - (A + 1.0f) * cosw0);
+            na2 = (A + 1.0f) - (A - 1.0f) * cosw0 - sqrtA2alpha;
+            break;
+
+        case StageShape::Peak:
+        default:
+            nb0 = 1.0f + alpha * A;
+            nb1 = -2.0f * cosw0;
+            nb2 = 1.0f - alpha * A;
+            na0 = 1.0f + alpha / A;
+            na1 = -2.0f * cosw0;
+            na2 = 1.0f - alpha / A;
+            break;
+    }
+
+    b0[stage] = nb0 / na0;
+    b1[stage] = nb1 / na0;
+    b2[stage] = nb2 / na0;
+    a1[stage] = na1 / na0;
+    a2[stage] = na2 / na0;
+}
+
+void DualCoreDSP::InputEQ::updateCoefficients(double sr)
+{
+    static constexpr StageShape bandShapes[NUM_EQ_BANDS] = {
+        StageShape::LowShelf, StageShape::Peak, StageShape::Peak, StageShape::HighShelf
+    };
+
+    // Flat bands and disabled legacy stages are skipped, but every stage keeps its own
+    // slot, so switching one on or off never moves another stage's filter state
+    for (int band = 0; band < NUM_EQ_BANDS; ++band)
+    {
+        const auto& b = bands[static_cast<size_t>(band)];
+        const bool isActive = std::abs(b.gainDb) >= 0.01f;
+        if (isActive)
+            setStage(band, bandShapes[band], b.frequency, b.gainDb, b.q, sr);
+        setStageActive(band, isActive);
+    }
+
+    // Legacy HI BOOST / HI CUT switches as fixed shelves
+    if (legacyBoost)
+        setStage(BOOST_STAGE, StageShape::HighShelf, 3000.0f, 6.0f, 0.707f, sr);
+    setStageActive(BOOST_STAGE, legacyBoost);
+    if (legacyCut)
+        setStage(CUT_STAGE, StageShape::HighShelf, 8000.0f, -12.0f, 0.707f, sr);
+    setStageActive(CUT_STAGE, legacyCut);
+
+    dirty = false;
+}
+
+void DualCoreDSP::InputEQ::setStageActive(int stage, bool isActive)
+{
+    // A stage switching off drops its history, so it starts clean when it comes back
+    if (active[stage] && !isActive)
+    {
+        for (int lane = 0; lane < MAX_CHANNELS; ++lane)
+            s1[stage][lane] = s2[stage][lane] = 0.0f;
+    }
+    active[stage] = isActive;
+}
+
+void DualCoreDSP::InputEQ::processFrame(float* frame, int numLanes)
+{
+    // Transposed direct form II; the lane loop is a plain contiguous loop so the
+    // compiler processes the channels of a stage in vector passes
+    for (int stage = 0; stage < NUM_EQ_STAGES; ++stage)
+    {
+        if (!active[stage])
+            continue;
+
+        const float sb0 = b0[stage], sb1 = b1[stage], sb2 = b2[stage];
+        const float sa1 = a1[stage], sa2 = a2[stage];
+        float* z1 = s1[stage];
+        float* z2 = s2[stage];
+
+        for (int lane = 0; lane < numLanes; ++lane)
+        {
+            const float x = frame[lane];
+            const float y = sb0 * x + z1[lane];
+            z1[lane] = sb1 * x - sa1 * y + z2[lane];
+            z2[lane] = sb2 * x - sa2 * y;
+            frame[lane] = y;
+        }
+    }
 }
 
-void DualCoreDSP::ShelfFilter::reset()
+void DualCoreDSP::InputEQ::reset()
 {
-    z1 = 0.0f;
+    for (int stage = 0; stage < NUM_EQ_STAGES; ++stage)
+    {
+        for (int lane = 0; lane < MAX_CHANNELS; ++lane)
+        {
+            s1[stage][lane] = 0.0f;
+            s2[stage][lane] = 0.0f;
+        }
+    }
 }
@@ -3,6 +3,9 @@
 #include <juce_dsp/juce_dsp.h>
 #include <cmath>
 #include <array>
+#include <vector>
+#include <cstdint>
+#include <bitset>
 
 // DualCore Filter DSP - Dual multimode filters with modulation
 class DualCoreDSP
@@ -13,7 +16,8 @@ public:
         LowPass = 0,
         HighPass,
         BandPass,
-        Notch          // LP + HP combined
+        Notch,         // LP + HP combined
+        Morph          // Continuous LP -> BP -> HP -> Notch (set by morph amount)
     };
 
     enum class LFOWaveform
@@ -52,7 +56,9 @@ public:
         Tube,          // Asymmetric tube-style
         Tape,          // Tape saturation with compression
         Hard,          // Hard clipping
-        Fuzz           // Aggressive fuzz/distortion
+        Fuzz,          // Aggressive fuzz/distortion
+        Fold,          // Wavefolder, antialiased (ADAA)
+        Crush          // Sample-rate and bit-depth reduction
     };
 
     enum class FilterType
@@ -65,6 +71,45 @@ public:
         OTA            // OTA-based (80s polysynth) - punchy, snappy
     };
 
+    // Signal feeding the ADSR trigger and the Input follower
+    enum class DetectorSource
+    {
+        Main = 0,
+        Sidechain
+    };
+
+    // How the two filters are connected
+    enum class FilterRouting
+    {
+        Series = 0,    // F1 -> F2
+        Parallel,      // F1 + F2, weighted by the balance
+        Split,         // Even channels (L / mid) -> F1, odd channels (R / side) -> F2
+        Feedback,      // F1 -> F2, with F2 fed back into F1 through a delay
+        Cascade        // F1 -> F2 -> F1 -> F2 (two identical stages, twice the slope)
+    };
+
+    // What triggers and releases the ADSR
+    enum class EnvTrigger
+    {
+        Audio = 0,     // Input (or sidechain) level crossing the sensitivity threshold
+        MIDI,          // Note-on triggers, releasing the last held note releases
+        Both
+    };
+
+    // Audio-rate cross-modulation paths (besides the FM section's Filter 1 -> Filter 2)
+    enum class CrossModPath
+    {
+        Filter2ToFilter1 = 0,  // Filter 2's previous output -> Filter 1 frequency
+        SelfFM                 // Each filter's previous output -> its own frequency
+    };
+
+    // Signal frequency-modulating Filter 2
+    enum class FMSource
+    {
+        Filter1 = 0,
+        Sidechain
+    };
+
     // Modulation Matrix
     enum class ModSource
     {
@@ -72,7 +117,21 @@ public:
         LFO1,
         LFO2,
         Envelope,
-        InputFollower
+        InputFollower,
+        Velocity,      // Last MIDI note-on velocity
+        Sequencer,     // Step sequencer
+        InputLow,      // Input follower per band (low/mid/high)
+        InputMid,
+        InputHigh,
+        InputBrightness,  // Spectral centroid of the input
+        Macro1,        // Macros 1-8 (0 to 1), used by the macro targets
+        Macro2,
+        Macro3,
+        Macro4,
+        Macro5,
+        Macro6,
+        Macro7,
+        Macro8
     };
 
     enum class ModDestination
@@ -87,7 +146,19 @@ public:
         LFO1Rate,
         LFO2Rate,
         Mix,
-        AMAmount
+        AMAmount,
+        Filter1Type,
+        Filter2Type,
+        Filter1Morph,
+        Filter2Morph,
+        LFO1Depth,     // Legacy LFO1 depth
+        EnvAmount,     // Legacy envelope amount
+        Slot1Amount,   // Mod slot amounts (modulation of modulation)
+        Slot2Amount,
+        Slot3Amount,
+        Slot4Amount,
+        Slot5Amount,
+        Slot6Amount
     };
 
     struct ModulationSlot
@@ -97,34 +168,104 @@ public:
         float amount = 0.0f;  // -1.0 to 1.0 (bipolar)
     };
 
+    // One macro -> destination mapping: the macro's 0-1 travel, bent by the curve,
+    // sweeps the modulation from rangeMin to rangeMax (-1 to 1, as a slot amount)
+    struct MacroTarget
+    {
+        int macro = -1;  // 0 to NUM_MACROS - 1, -1 = unused
+        ModDestination destination = ModDestination::None;
+        float rangeMin = 0.0f;
+        float rangeMax = 1.0f;
+        float curve = 0.0f;  // -1 (slow start) to 1 (fast start), 0 = linear
+    };
+
+    // Every filter core produces all outputs in a single pass
+    struct FilterTaps
+    {
+        float lowpass = 0.0f;
+        float bandpass = 0.0f;
+        float highpass = 0.0f;
+        float notch = 0.0f;
+    };
+
+    // Per-sample destinations for individual filter outputs (e.g. extra output buses).
+    // Null pointers are skipped; each pointer must hold at least one block of samples.
+    // Like the main bus, they are decoded from M/S and delayed to the full plugin latency
+    struct TapOutputs
+    {
+        float* lowpass = nullptr;
+        float* bandpass = nullptr;
+        float* highpass = nullptr;
+        float* notch = nullptr;
+        float* filtered = nullptr;  // The filter's mode/morph output
+    };
+
     static constexpr int NUM_MOD_SLOTS = 6;
+    static constexpr int NUM_MACROS = 8;
+    static constexpr int NUM_MACRO_TARGETS = 16;
+    static constexpr int NUM_MOD_SOURCES = static_cast<int>(ModSource::Macro8) + 1;
+    static constexpr int NUM_MOD_DESTINATIONS = static_cast<int>(ModDestination::Slot6Amount) + 1;
+    static constexpr int NUM_EQ_BANDS = 4;   // Low shelf, Peak 1, Peak 2, High shelf
+    static constexpr int MAX_CHANNELS = 12;  // Up to 7.1.4
+    static constexpr int NUM_FILTER_TYPES = 6;
+    static constexpr int MAX_UNISON_VOICES = 8;
+    static constexpr int MAX_POLY_VOICES = 8;
+    static constexpr int MAX_BANDS = 4;      // Multiband: up to 3 crossover points
+    static constexpr int NUM_TAP_SLOTS = 11; // Per channel: 5 taps for each filter, plus dry
+    static constexpr float TYPE_CROSSFADE_MS = 10.0f;
+    static constexpr float MAX_LOOKAHEAD_MS = 10.0f;
+    static constexpr float MAX_FEEDBACK_DELAY_MS = 20.0f;
+    static constexpr int MAX_SEQ_STEPS = 64;
+    static constexpr int NUM_SNAPSHOTS = 8;
+    static constexpr float MAX_SNAPSHOT_FADE_MS = 500.0f;
+    static constexpr float MAX_LFO_AUDIO_RATE = 5000.0f;
+    static constexpr int LFO_BLOCK_SIZE = 32;  // LFOs are rendered this many samples at a time
+    static constexpr float LIMITER_LOOKAHEAD_MS = 2.0f;
+    static constexpr float LIMITER_RELEASE_MS = 100.0f;
 
     DualCoreDSP() = default;
 
     void prepare(double sampleRate, int samplesPerBlock);
     void reset();
-    void process(juce::AudioBuffer<float>& buffer);
+    void process(juce::AudioBuffer<float>& buffer, const juce::AudioBuffer<float>* sidechain = nullptr,
+                 const juce::MidiBuffer* midi = nullptr);  // Blocks longer than prepared run in chunks
 
     // === Input Section ===
     void setInputGain(float gainDb);
     void setHiBoost(bool enabled);
     void setHiCut(bool enabled);
-    void setLimiterEnabled(bool enabled);
+    void setLimiterEnabled(bool enabled);        // Input limiter
+    void setOutputLimiterEnabled(bool enabled);  // Final output limiter
+    void setLimiterCeiling(float ceilingDb);     // True-peak ceiling for both limiters
+    void setEQBand(int band, float freqHz, float gainDb, float q);  // band 0-3 (see NUM_EQ_BANDS)
+    void setChannelExcluded(int channel, bool excluded);  // e.g. centre/LFE in surround layouts
 
     // === Filter 1 Parameters ===
     void setFilter1Frequency(float freqHz);
     void setFilter1Resonance(float resonance);  // 0.0 to 1.0
     void setFilter1Mode(FilterMode mode);
     void setFilter1Type(FilterType type);
+    void setFilter1Morph(float morph);  // 0.0 to 1.0 (LP -> BP -> HP -> Notch)
 
     // === Filter 2 Parameters ===
     void setFilter2Frequency(float freqHz);
     void setFilter2Resonance(float resonance);
     void setFilter2Mode(FilterMode mode);
     void setFilter2Type(FilterType type);
+    void setFilter2Morph(float morph);
 
-    // === FM Modulation (Filter 1 -> Filter 2 frequency) ===
+    // === FM Modulation (Filter 1 or sidechain -> Filter 2 frequency) ===
     void setFMAmount(float amount);  // 0.0 to 1.0
+    void setFMSource(FMSource source);
+
+    // === Cross-modulation (one sample delayed, so the loops are well defined) ===
+    void setCrossMod(CrossModPath path, float amount, bool exponential);  // 0.0 to 1.0; true = octaves, false = Hz
+
+    // === Cutoff Modulation Scale ===
+    void setExponentialFreqMod(bool exponential);  // false = linear Hz, true = octaves
+
+    // === Resonance Compensation (make-up gain per filter for its type and resonance) ===
+    void setResonanceCompensation(bool enabled);
 
     // === ADSR Envelope -> Filter Frequency ===
     void setEnvAttack(float ms);
@@ -133,6 +274,12 @@ public:
     void setEnvRelease(float ms);
     void setEnvAmount(float amount);  // -1.0 to 1.0 (can invert)
     void setEnvSensitivity(float sens);  // Input sensitivity for triggering
+    void setDetectorSource(DetectorSource source);  // Main input or sidechain for trigger/follower
+    void setLookahead(float ms);  // 0 = off, up to MAX_LOOKAHEAD_MS (delays the audio path)
+    void setEnvTrigger(EnvTrigger trigger);
+
+    // Latency introduced by the lookahead delay and limiters (report to the host)
+    int getLatencySamples() const;
 
     // === LFO1 -> Filter Frequency ===
     void setLFORate(float hz);
@@ -141,6 +288,8 @@ public:
     void setLFOTarget(int target);  // 0=Filter1, 1=Filter2, 2=Both
     void setLFOSync(bool sync);
     void setLFODivision(NoteDivision div);
+    void setLFORetrigger(bool enabled);  // MIDI note-on restarts the LFO1 and LFO2 phase
+    void setLFOAudioRate(float hz);      // 0 = off, else MAX_LFO_AUDIO_RATE max (overrides rate and sync)
 
     // === LFO2 ===
     void setLFO2Rate(float hz);
@@ -148,13 +297,69 @@ public:
     void setLFO2Waveform(LFOWaveform wave);
     void setLFO2Sync(bool sync);
     void setLFO2Division(NoteDivision div);
+    void setLFO2AudioRate(float hz);
 
     // === Host Tempo ===
     void setHostBPM(double bpm);
+    void setHostPosition(double ppqPosition, bool playing);  // Locks the sequencer to the host
+
+    // === Step Sequencer (mod source) ===
+    void setSequencerLength(int steps);            // 1 to MAX_SEQ_STEPS
+    void setSequencerDivision(NoteDivision div);   // Length of one step
+    void setSequencerGateLength(float length);     // 0.05 to 1.0 of a step
+    void setSequencerStep(int step, float value, bool gate, bool glide);  // value -1.0 to 1.0
+    int getSequencerStep() const { return sequencerStep; }  // Step at the end of the last block
 
     // === Modulation Matrix ===
     void setModSlot(int slotIndex, ModSource source, ModDestination dest, float amount);
 
+    // === Macros ===
+    void setMacro(int index, float value);  // 0.0 to 1.0
+    void setMacroTarget(int targetIndex, const MacroTarget& target);
+    bool hasModulationCycle() const { return modRouting->cycleDetected; }  // Slot amounts modulating each other
+
+    // === Snapshots ===
+    // The settings a snapshot recalls (same units as the setters): the ones the per-sample
+    // loop can crossfade. Routing, EQ, modulator timing and macros stay on the panel
+    struct Snapshot
+    {
+        float filter1Freq = 1000.0f;
+        float filter1Reso = 0.5f;
+        FilterMode filter1Mode = FilterMode::LowPass;
+        FilterType filter1Type = FilterType::SVF;
+        float filter1Morph = 0.0f;
+        float filter2Freq = 2000.0f;
+        float filter2Reso = 0.5f;
+        FilterMode filter2Mode = FilterMode::LowPass;
+        FilterType filter2Type = FilterType::SVF;
+        float filter2Morph = 0.0f;
+        float fmAmount = 0.0f;
+        float driveAmount = 0.0f;
+        DriveType driveType = DriveType::Soft;
+        float dryWetMix = 1.0f;
+        float amAmount = 0.0f;
+        float routingBalance = 0.5f;
+        float envAmount = 0.0f;
+        float lfoDepth = 0.0f;
+        std::array<ModulationSlot, NUM_MOD_SLOTS> modSlots = {};
+    };
+
+    enum class SnapshotMode
+    {
+        Off = 0,  // Panel settings
+        Manual,   // The selected snapshot
+        Step,     // Snapshots 1..count in turn, one per grid step, with a short crossfade
+        Glide     // Crossfades from each snapshot to the next across a whole grid step
+    };
+
+    void setSnapshot(int index, const Snapshot& snapshot);  // Prepared here, not on recall
+    void clearSnapshot(int index);                          // Empty slots play the panel settings
+    void setSnapshotMode(SnapshotMode mode);
+    void setSnapshotSelect(int index);                      // Manual mode, 0 to NUM_SNAPSHOTS - 1
+    void setSnapshotSequence(int count, NoteDivision div);  // Step/Glide: snapshots 1..count, one per div
+    void setSnapshotFade(float ms);                         // Manual/Step crossfade, up to MAX_SNAPSHOT_FADE_MS
+    int getActiveSnapshot() const { return activeSnapshot; }  // -1 = panel
+
     // === AM (Amplitude Modulation from Filter 2) ===
     void setAMAmount(float amount);  // 0.0 to 1.0
     void setAMAttack(float ms);
@@ -166,9 +371,39 @@ public:
     void setDrivePrePost(bool post);       // false = pre-filter, true = post-filter
 
     // === Routing ===
-    void setFilterRouting(bool parallel);  // true = parallel, false = series
+    void setFilterRouting(FilterRouting routing);
+    void setRoutingBalance(float balance);  // Parallel: 0 = Filter 1 only, 0.5 = equal, 1 = Filter 2 only
+    void setFeedback(float amount, float delayMs);  // Feedback: 0.0 to 0.95, 0 to MAX_FEEDBACK_DELAY_MS (0 = one sample)
     void setDryWetMix(float wet);  // 0.0 to 1.0
 
+    // === Stereo (M/S applies to stereo layouts only) ===
+    void setMidSide(bool enabled);          // Filter mid (channel 0) and side (channel 1) instead of L/R
+    void setSideLink(bool linked);          // true = side uses the mid settings, false = offsets apply
+    void setSideFreqOffset(float octaves);  // -4 to +4 octaves
+    void setSideResoOffset(float offset);   // -1.0 to 1.0
+    void setStereoSpread(float spread);     // 0.0 to 1.0, LFO1 offsets alternate channels' cutoffs
+
+    // === Analog Drift (per-channel component tolerance and slow wander) ===
+    void setDrift(float amount);        // 0.0 to 1.0 (0 = channels identical)
+    void setDriftSeed(uint32_t seed);   // Per instance; a given seed drifts the same way after reset()
+
+    // === Unison (detuned copies of both filters on every channel) ===
+    void setUnison(int voices, float detune, float resoSpread);  // 1 to MAX_UNISON_VOICES, 0.0 to 1.0, 0.0 to 1.0
+
+    // === Multiband (crossover in front of the filters, one filter pair per band) ===
+    void setBandCount(int bands);                    // 1 (off) to MAX_BANDS
+    void setCrossover(int index, float freqHz);      // index 0 to MAX_BANDS - 2, kept ascending
+    void setBand(int band, float freqOffset, float drive, float mix);  // -4 to +4 octaves, 0.0 to 1.0, 0.0 to 1.0
+
+    // === Polyphonic mode (MIDI notes play keytracked filter voices) ===
+    void setPolyMode(bool enabled);
+    void setKeyTracking(float amount);  // 0.0 to 1.0, 1 = cutoff follows the note (filter freq = cutoff at C4)
+
+    // === Multi-output taps ===
+    void setTapOutputs(int filterIndex, int channel, const TapOutputs& outputs);  // filterIndex 0/1, channel < MAX_CHANNELS
+    void setDryOutput(int channel, float* destination);  // Dry (unfiltered) signal, channel < MAX_CHANNELS
+    void clearTapOutputs();  // Clears the dry outputs too
+
 private:
     // Multi-type Filter with multiple outputs
     struct SVFilter
@@ -189,9 +424,13 @@ private:
         // Parameters
         float frequency = 1000.0f;
         float resonance = 0.5f;
-        FilterMode mode = FilterMode::LowPass;
         FilterType type = FilterType::SVF;
 
+        // Outputs from the last processed sample and their mix weights
+        FilterTaps taps;
+        float morphPosition = 0.0f;  // 0=LP, 1=BP, 2=HP, 3=Notch (fractions blend neighbours)
+        float tapGains[4] = {1.0f, 0.0f, 0.0f, 0.0f};
+
         // Coefficients
         float f = 0.0f;      // Normalized frequency
         float q = 0.0f;      // Q factor / feedback
@@ -201,19 +440,68 @@ private:
         void updateCoefficients(double sampleRate);
         float process(float input);
         void reset();
+        void setMorphPosition(float position);
 
     private:
+        float mixTaps() const
+        {
+            return taps.lowpass * tapGains[0] + taps.bandpass * tapGains[1]
+                 + taps.highpass * tapGains[2] + taps.notch * tapGains[3];
+        }
+
         float processSVF(float input);
         float processLadder(float input);
         float processDiode(float input);
         float processMS20(float input);
         float processSteiner(float input);
         float processOTA(float input);
+    };
 
-        // Saturation helpers
-        float tanhApprox(float x);
-        float softClip(float x);
-        float diodeClip(float x);
+    // Up to LANES filter cores of one type running side by side (structure of
+    // arrays), so independent copies share one loop the compiler can vectorise.
+    // Every lane has its own cutoff/resonance and mirrors the matching SVFilter core
+    struct FilterLanes
+    {
+        static constexpr int LANES = 8;
+
+        FilterType type = FilterType::SVF;
+        float tapGains[4] = {1.0f, 0.0f, 0.0f, 0.0f};  // Morph weights, shared by all lanes
+
+        alignas(32) float frequency[LANES] = {};
+        alignas(32) float resonance[LANES] = {};
+
+        // Coefficients (see SVFilter)
+        alignas(32) float f[LANES] = {};
+        alignas(32) float q[LANES] = {};
+        alignas(32) float g[LANES] = {};
+        alignas(32) float k[LANES] = {};
+
+        // SVF, ladder and MS-20/Steiner/OTA state
+        alignas(32) float lowpass[LANES] = {};
+        alignas(32) float bandpass[LANES] = {};
+        alignas(32) float stage[4][LANES] = {};
+        alignas(32) float s1[LANES] = {};
+        alignas(32) float s2[LANES] = {};
+
+        // Outputs from the last processed sample
+        alignas(32) float tapLowpass[LANES] = {};
+        alignas(32) float tapBandpass[LANES] = {};
+        alignas(32) float tapHighpass[LANES] = {};
+        alignas(32) float tapNotch[LANES] = {};
+        alignas(32) float output[LANES] = {};
+
+        void updateCoefficients(double sampleRate);
+        void process(const float* input);  // input[LANES] -> output[LANES] (plus taps)
+        void reset();
+
+    private:
+        void mixTaps();
+        void processSVF(const float* input);
+        void processLadder(const float* input);
+        void processDiode(const float* input);
+        void processMS20(const float* input);
+        void processSteiner(const float* input);
+        void processOTA(const float* input);
     };
 
     // ADSR Envelope
@@ -238,17 +526,48 @@ private:
         void reset();
     };
 
-    // LFO
+    // Polyphonic voice pool. Note and envelope state per voice, one lane per voice
+    // so it lines up with the per-channel FilterLanes banks that do the filtering
+    struct PolyVoicePool
+    {
+        static constexpr int VOICES = MAX_POLY_VOICES;
+        enum Stage : int { Idle = 0, Attack, Decay, Sustain, Release };
+
+        alignas(32) int stage[VOICES] = {};
+        alignas(32) float level[VOICES] = {};       // Envelope output
+        alignas(32) float velocity[VOICES] = {};
+        alignas(32) float keyOctaves[VOICES] = {};  // Note relative to C4
+        alignas(32) float gain[VOICES] = {};        // level * velocity, weights the voice sum
+        int note[VOICES] = {};
+        uint32_t startTime[VOICES] = {};
+        uint32_t clock = 0;
+
+        void noteOn(int noteNumber, float noteVelocity);
+        void noteOff(int noteNumber);
+        void releaseAll();
+        void advance(const ADSREnvelope& settings);  // One sample of every voice's envelope
+        void reset();
+
+    private:
+        int findVoice(int noteNumber) const;  // Same note, then idle, then steal
+    };
+
+    // LFO, rendered a block at a time. Square and saws are PolyBLEP-corrected and the
+    // sine comes from a rotating phasor, so audio rates stay clean and cheap
     struct LFO
     {
         float phase = 0.0f;
         float phaseIncrement = 0.0f;
+        float rate = 1.0f;        // Free or tempo-synced rate (Hz)
+        float audioRate = 0.0f;   // Audio-rate mode (Hz), 0 = off
+        double sampleRate = 44100.0;
         LFOWaveform waveform = LFOWaveform::Sine;
         float randomValue = 0.0f;
         float lastRandomValue = 0.0f;
 
         void setRate(float hz, double sampleRate);
-        float process();
+        void render(float* output, int numSamples, float rateMod);  // rateMod from the matrix (Hz)
+        void retrigger();
         void reset();
     };
 
@@ -265,57 +584,501 @@ private:
         void reset();
     };
 
-    // Hi/Lo shelf filters for input section
-    struct ShelfFilter
+    // Low/mid/high band levels and the spectral centroid of the detector signal. A Haar
+    // (half-band sum/difference) tree splits off one octave per level at successively
+    // halved rates, so the analysis costs about two adds per input sample. Each level's
+    // power is smoothed at its own rate, which keeps the result independent of block size
+    struct SpectralFollower
+    {
+        static constexpr int MAX_LEVELS = 10;
+        static constexpr int NUM_OUTPUTS = 4;  // Low, mid, high, brightness (ModSource order)
+
+        int numLevels = 0;
+        std::array<float, MAX_LEVELS + 1> power = {};      // Per level; the last is the low residue
+        std::array<float, MAX_LEVELS + 1> powerCoef = {};
+        std::array<float, MAX_LEVELS + 1> octave = {};     // log2 of the level's centre frequency
+        std::array<int, MAX_LEVELS + 1> band = {};         // 0 = low, 1 = mid, 2 = high
+        std::array<float, MAX_LEVELS> pending = {};        // Odd sample carried to the next block
+        std::array<bool, MAX_LEVELS> hasPending = {};
+
+        // Outputs (-1 to 1), ramped across the block from the previous block's values
+        std::array<float, NUM_OUTPUTS> output = {};
+        std::array<float, NUM_OUTPUTS> outputStep = {};
+        std::array<float, NUM_OUTPUTS> outputTarget = {};
+        int rampLength = 0;  // Length of the previous block's ramp
+
+        void prepare(double sampleRate);
+        void process(float* signal, int numSamples);  // Overwrites signal
+        float getOutput(int index, int sample) const
+        {
+            return output[static_cast<size_t>(index)] + outputStep[static_cast<size_t>(index)] * static_cast<float>(sample);
+        }
+        void reset();
+    };
+
+    // Fixed-capacity ring buffer delay (allocated in prepare(), never while processing)
+    struct DelayLine
+    {
+        std::vector<float> buffer;
+        int writeIndex = 0;
+        int delaySamples = 0;
+
+        void prepare(int maxDelaySamples);
+        void setDelay(int samples);
+        float process(float input);
+        void reset();
+    };
+
+    // Lookahead brickwall limiter with 4x true-peak detection. The detector
+    // sees the undelayed signal; the gain reaches its target before the
+    // peak leaves the delay line, so the ceiling is never exceeded
+    struct TruePeakLimiter
     {
-        float z1 = 0.0f;
-        float a0 = 1.0f, a1 = 0.0f, b1 = 0.0f;
-        void setHighShelf(float freqHz, float gainDb, double sampleRate);
-        void setLowShelf(float freqHz, float gainDb, double sampleRate);
+        static constexpr int INTERP_TAPS = 12;  // Taps per polyphase branch (4 branches)
+
+        DelayLine delay;
+
+        // Sliding-window peak: monotonic deque in a fixed ring
+        std::vector<float> peakValues;
+        std::vector<uint32_t> peakTimes;
+        int dequeFront = 0;
+        int dequeCount = 0;
+        uint32_t time = 0;
+        int windowLength = 1;
+
+        // Boxcar smoothing of the gain envelope
+        std::vector<float> boxBuffer;
+        double boxSum = 0.0;
+        int boxIndex = 0;
+
+        float history[INTERP_TAPS] = {};
+        int historyIndex = 0;
+
+        float ceiling = 0.891f;
+        float releaseCoef = 0.0f;
+        float gainEnvelope = 1.0f;
+
+        void prepare(double sampleRate);
+        void setCeiling(float ceilingDb);
         float process(float input);
         void reset();
+        int getLatencySamples() const { return windowLength - 1 + INTERP_TAPS / 2; }
+
+    private:
+        float detectTruePeak(float input);
+        float slidingMax(float peak);
+    };
+
+    // Keeps the outgoing filter running while a new type fades in, so type
+    // changes (automation or modulation) never reset state mid-signal
+    struct TypeCrossfade
+    {
+        FilterType requestedType = FilterType::SVF;
+        int samplesRemaining = 0;
+        int lengthSamples = 1;
+
+        bool isActive() const { return samplesRemaining > 0; }
+        float getIncomingGain() const
+        {
+            return 1.0f - static_cast<float>(samplesRemaining) / static_cast<float>(lengthSamples);
+        }
     };
 
-    // Saturation/Drive processing
-    float processDrive(float input);
+    void setFilterFrequency(int filterIndex, float freqHz);
+    void setFilterResonance(int filterIndex, float resonance);
+    void requestFilterType(int filterIndex, TypeCrossfade& fade, FilterType type);
+    void advanceTypeCrossfade(int filterIndex, TypeCrossfade& fade);
+    float processWithCrossfade(SVFilter& filter, SVFilter& outgoing, const TypeCrossfade& fade, float input);
+    void processLanesWithCrossfade(FilterLanes& lanes, FilterLanes& outgoing, const TypeCrossfade& fade, const float* input);
+    float processUnison(FilterLanes& lanes, FilterLanes& outgoing, SVFilter& filter, const TypeCrossfade& fade,
+                        float input, float voiceOutput);
+    float applyFM(float baseFreq, float filter1Output, float amount, float sidechainSample) const;
+    float applyCrossMod(float baseFreq, float modulator, CrossModPath path) const;
+
+    // Resonance compensation, at control rate: the target gain is set once per block and
+    // the applied gain ramps to it, so the filters only pay for one multiply per output
+    static float getResonanceCompensation(FilterType type, float resonance);
+    void updateResonanceCompensation(int numSamples);
+    float applyResonanceCompensation(SVFilter& filter, int filterIndex, float output) const;
+    void applyResonanceCompensation(FilterLanes& lanes, int filterIndex) const;
+
+    static float getMorphPosition(FilterMode mode, float morph);
+    static double getDivisionQuarterNotes(NoteDivision div);
+    void writeTaps(const SVFilter& filter, float output, const TapOutputs& outputs, int sample);
+    std::array<float*, NUM_TAP_SLOTS> getTapDestinations(int channel) const;
+    void finishTapOutputs(int numChannels, int numSamples, bool msActive);
+
+    // Input EQ: cascade of TDF-II biquads (low shelf, 2 peaks, high shelf, plus
+    // the fixed HI BOOST / HI CUT shelves). All channels run side by side in lanes
+    struct InputEQ
+    {
+        enum class StageShape { LowShelf, Peak, HighShelf };
+
+        struct Band
+        {
+            float frequency = 1000.0f;
+            float gainDb = 0.0f;
+            float q = 0.707f;
+        };
+
+        static constexpr int NUM_EQ_STAGES = NUM_EQ_BANDS + 2;
+
+        std::array<Band, NUM_EQ_BANDS> bands;
+        bool legacyBoost = false;
+        bool legacyCut = false;
+        bool dirty = true;  // Coefficients are only recalculated after a change
+
+        // Fixed stage slots (bands, then HI BOOST and HI CUT), each with its own state.
+        // Inactive slots are skipped; their state is cleared when they switch off
+        static constexpr int BOOST_STAGE = NUM_EQ_BANDS;
+        static constexpr int CUT_STAGE = NUM_EQ_BANDS + 1;
+        bool active[NUM_EQ_STAGES] = {};
+        float b0[NUM_EQ_STAGES] = {}, b1[NUM_EQ_STAGES] = {}, b2[NUM_EQ_STAGES] = {};
+        float a1[NUM_EQ_STAGES] = {}, a2[NUM_EQ_STAGES] = {};
+        alignas(16) float s1[NUM_EQ_STAGES][MAX_CHANNELS] = {};
+        alignas(16) float s2[NUM_EQ_STAGES][MAX_CHANNELS] = {};
+
+        void setBand(int band, float freqHz, float gainDb, float q);
+        void setLegacyStages(bool boost, bool cut);
+        void updateCoefficients(double sampleRate);
+        void processFrame(float* frame, int numLanes);  // In place, numLanes <= MAX_CHANNELS
+        void reset();
+
+    private:
+        void setStage(int stage, StageShape shape, float freqHz, float gainDb, float q, double sampleRate);
+        void setStageActive(int stage, bool isActive);
+    };
+
+    // Linkwitz-Riley crossover (LR4: two cascaded Butterworth sections per side).
+    // The lower bands are allpass-compensated for the splits above them, so the
+    // bands sum to a flat (allpass) response
+    struct Crossover
+    {
+        // TPT state-variable section at Butterworth Q
+        struct Section
+        {
+            static constexpr float K = 1.41421356f;  // 1 / Q
+
+            float a1 = 0.0f, a2 = 0.0f, a3 = 0.0f;
+            float ic1 = 0.0f, ic2 = 0.0f;
+
+            void setCutoff(float freqHz, double sampleRate);
+            void process(float input, float& lowpass, float& bandpass, float& highpass);
+            float processAllpass(float input);
+            void reset();
+        };
+
+        // The shared first section gives LP2/HP2; a second section on each side makes them LR4
+        struct Split
+        {
+            Section first, low, high;
+        };
+
+        std::array<Split, MAX_BANDS - 1> splits;
+        std::array<std::array<Section, MAX_BANDS - 1>, MAX_BANDS - 2> allpass;  // [band][split]
+        int numBands = 1;
+
+        void configure(int bands, const std::array<float, MAX_BANDS - 1>& frequencies, double sampleRate);
+        void process(float input, float* bands);  // bands[numBands], lowest first
+        void reset();
+    };
+
+    // Saturation/Drive processing. Each drive point (pre, post, per band) keeps its own
+    // state for the types that need memory: the folder's previous input for ADAA and the
+    // crusher's sample-and-hold
+    struct DriveState
+    {
+        float lastDriven = 0.0f;  // Previous input times drive
+        float held = 0.0f;        // Crush: current held sample
+        float holdPhase = 1.0f;   // Crush: a new sample is taken when this passes 1
+        void reset() { *this = DriveState{}; }
+    };
+    float processDrive(float input, float amount, DriveState& state);  // amount 0.0 to 1.0
+    // One block of at most the prepared size; midiOffset is where it starts in the host block
+    void processChunk(juce::AudioBuffer<float>& buffer, const juce::AudioBuffer<float>* sidechain,
+                      const juce::MidiBuffer* midi, int midiOffset);
+    void computeMonoSum(const juce::AudioBuffer<float>& source, int numSamples, float gain, float* dest);
+    void encodeMidSide(juce::AudioBuffer<float>& buffer, int numSamples);
+    void decodeMidSide(float* mid, float* side, int numSamples);  // In place
     float saturateSoft(float input, float drive);
     float saturateTube(float input, float drive);
     float saturateTape(float input, float drive);
     float saturateHard(float input, float drive);
     float saturateFuzz(float input, float drive);
-    float softLimit(float input);
+    static float foldAntialiased(float driven, float lastDriven);
+    static float crush(float input, float amount, DriveState& state);
 
     // Oversampling
     std::unique_ptr<juce::dsp::Oversampling<float>> oversampling;
 
+    // A channel's cutoff (octaves), resonance and drive (relative) offsets: a fixed
+    // tolerance drawn from the seed plus a slow random walk (Ornstein-Uhlenbeck, unit
+    // variance). New values are drawn every DRIFT_INTERVAL samples from an xorshift
+    // generator and ramped to, so the audio path only adds a per-sample step
+    struct AnalogDrift
+    {
+        enum Target { Cutoff = 0, Resonance, Drive, NUM_TARGETS };
+
+        uint32_t rng = 1;
+        std::array<float, NUM_TARGETS> tolerance = {};  // -1 to 1
+        std::array<float, NUM_TARGETS> walk = {};
+        std::array<float, NUM_TARGETS> value = {};      // Current offsets
+        std::array<float, NUM_TARGETS> step = {};       // Per-sample ramp to the next draw
+
+        void seed(uint32_t newSeed);
+        float nextRandom();  // Uniform, -1 to 1
+        void update(float amount, float walkDecay, float walkNoise);
+        void advance()
+        {
+            for (size_t i = 0; i < value.size(); ++i)
+                value[i] += step[i];
+        }
+    };
+
+    // Per-channel state. One entry per bus channel, kept in a contiguous bank;
+    // modulation is shared and computed once per sample for all channels
+    struct ChannelState
+    {
+        std::array<SVFilter, 2> filters;   // Filter 1, Filter 2
+        std::array<SVFilter, 2> outgoing;  // Outgoing engines during a type crossfade
+        std::array<FilterLanes, 2> unison; // Unison voices 2..N of each filter
+        std::array<FilterLanes, 2> unisonOutgoing;
+        std::array<FilterLanes, 2> poly;   // Poly mode: one lane per voice for each filter
+        std::array<FilterLanes, 2> polyOutgoing;
+        std::array<FilterLanes, 2> bands;  // Multiband: one lane per band for each filter
+        std::array<FilterLanes, 2> bandsOutgoing;
+        Crossover crossover;
+        std::array<SVFilter, 2> cascade;   // Second stage of the Cascade routing
+        std::array<SVFilter, 2> cascadeOutgoing;
+        DelayLine feedbackDelay;           // Feedback routing: F2 -> F1 path
+        float feedbackSample = 0.0f;
+        std::array<float, 2> lastOutput = {};  // Previous filter outputs, for cross-modulation
+        EnvelopeFollower amFollower;
+        DelayLine lookahead;
+        DelayLine limiterDry;    // Keeps dry aligned with the input limiter delay
+        DelayLine bypassDelay;   // Output limiter latency for excluded channels
+        std::array<DelayLine, NUM_TAP_SLOTS> tapDelays;  // Output limiter latency for the tap outputs
+        TruePeakLimiter inputLimiter, outputLimiter;
+        bool excluded = false;   // Passed through (latency-aligned) without processing
+        AnalogDrift drift;
+        DriveState preDrive, postDrive;
+        std::array<DriveState, MAX_BANDS> bandDrive;
+    };
+
+    // Routing kernels. One per topology, selected by compileRouting() whenever the
+    // routing changes, so the per-sample loop makes a single indirect call
+    struct FilterFrame
+    {
+        float frequency[2];  // Per-channel cutoff before FM
+        float resonance[2];
+        float fmAmount;
+        float sidechain;
+    };
+
+    struct RoutedSample
+    {
+        float output = 0.0f;    // Routed signal
+        float filter1 = 0.0f;   // Filter outputs for the taps
+        float filter2 = 0.0f;
+        float amSource = 0.0f;  // Signal followed by the AM section
+    };
+
+    using RoutingKernel = RoutedSample (DualCoreDSP::*)(ChannelState&, int, float, const FilterFrame&);
+
+    void compileRouting();
+    void updateCrossover();
+    float runFilter(ChannelState& state, int filterIndex, float freqHz, float resonance, float input);
+    float runCascadeFilter(ChannelState& state, int filterIndex, float freqHz, float resonance, float input);
+    RoutedSample routeSeries(ChannelState& state, int channel, float input, const FilterFrame& frame);
+    RoutedSample routeParallel(ChannelState& state, int channel, float input, const FilterFrame& frame);
+    RoutedSample routeSplit(ChannelState& state, int channel, float input, const FilterFrame& frame);
+    RoutedSample routeFeedback(ChannelState& state, int channel, float input, const FilterFrame& frame);
+    RoutedSample routeCascade(ChannelState& state, int channel, float input, const FilterFrame& frame);
+    RoutedSample routePoly(ChannelState& state, int channel, float input, const FilterFrame& frame);
+    RoutedSample routeMultiband(ChannelState& state, int channel, float input, const FilterFrame& frame);
+
+    // Poly mode
+    void handleMidiMessage(const juce::MidiMessage& message);
+    void updatePolyCutoffs(float modulatedEnvAmount);
+    void processPolyVoices(ChannelState& state, float input, float f1Freq, float f1Reso, float f2Freq, float f2Reso,
+                           float modulatedFM, float sidechainSample, float& output1, float& output2);
+
     // DSP components
-    SVFilter filter1L, filter1R;
-    SVFilter filter2L, filter2R;
+    std::array<ChannelState, MAX_CHANNELS> channelStates;
+    TypeCrossfade filter1Fade, filter2Fade;
     ADSREnvelope adsrEnv;
+    PolyVoicePool polyVoices;
+    const juce::MidiBuffer noMidi;  // Read when the host passes no events
+    std::bitset<128> heldNotes;     // Mono MIDI trigger: release once the last note is up
     LFO lfo;
     LFO lfo2;
+    std::array<float, LFO_BLOCK_SIZE> lfo1Block = {};
+    std::array<float, LFO_BLOCK_SIZE> lfo2Block = {};
+    int lfoBlockPos = 0;
+    int lfoBlockLength = 0;
+    float lfo1RateMod = 0.0f;
+    float lfo2RateMod = 0.0f;
     EnvelopeFollower inputEnvFollower;
-    EnvelopeFollower amEnvFollower;
-    ShelfFilter hiBoostL, hiBoostR;
-    ShelfFilter hiCutL, hiCutR;
+    SpectralFollower spectralFollower;
+    bool spectralRouted = false;  // Only analysed when a slot uses a band or brightness
+
+    // Block-wise detector and sidechain buffers (sized in prepare)
+    std::vector<float> detectorLevels;
+    std::vector<float> sidechainMono;
+    std::vector<float> msScratch;
+    std::vector<float> sequencerBlock;  // Sequencer output, rendered once per block
+    DelayLine sidechainLookahead;  // Keeps sidechain FM aligned with the lookahead audio
+    DetectorSource detectorSource = DetectorSource::Main;
+    FMSource fmSource = FMSource::Filter1;
+    InputEQ inputEQ;
 
     // Modulation Matrix
     std::array<ModulationSlot, NUM_MOD_SLOTS> modSlots;
+    std::array<MacroTarget, NUM_MACRO_TARGETS> macroTargets;
+    std::array<float, NUM_MACROS> macroValues = {};
+
+    // Mod slots and macro targets compile into two separate route lists. Slot routes go
+    // into a ModRoutingTable, evaluated per sample in dependency order (a slot whose amount
+    // is modulated runs after its modulators). Macro targets go into macroRoutes, which
+    // only move between blocks and are folded into staticModulation once per block. They
+    // are kept apart because snapshots store the slots but not the macros, so a recall
+    // swaps only the slot table
+    struct ModRoute
+    {
+        int source = 0;       // ModSource index
+        int destination = 0;  // ModDestination index
+        float amount = 0.0f;  // Slot amount, or macro range (max - min)
+        float offset = 0.0f;  // Macro range start
+        float exponent = 1.0f;  // Macro curve
+        int amountDestination = -1;  // SlotNAmount index modulating this route, -1 = none
+        bool carried = false;  // Closes a cycle: lands on the next sample
+    };
+    // Slot routes in evaluation order. The panel and every stored snapshot have their
+    // own table, so recalling a snapshot swaps the table pointer
+    struct ModRoutingTable
+    {
+        std::array<ModRoute, NUM_MOD_SLOTS> routes;
+        int numRoutes = 0;
+        bool cycleDetected = false;  // Some route is carried to the next sample
+        bool usesSequencer = false;
+        bool usesSpectral = false;   // A band follower or brightness is a source
+    };
+    ModRoutingTable panelRouting;
+    const ModRoutingTable* modRouting = &panelRouting;  // Table evaluated per sample
+    std::array<ModRoute, NUM_MACRO_TARGETS> macroRoutes;
+    int numMacroRoutes = 0;
+    bool modRoutingDirty = true;
+    std::array<float, NUM_MOD_SOURCES> modSourceValues = {};
+    std::array<float, NUM_MOD_DESTINATIONS> staticModulation = {};
+    std::array<float, NUM_MOD_DESTINATIONS> carriedModulation = {};
+
+    void compileModRouting();
+    void compileSlotRouting(const std::array<ModulationSlot, NUM_MOD_SLOTS>& slots, ModRoutingTable& table) const;
+    void evaluateModRoutes(const ModRoutingTable& table, std::array<float, NUM_MOD_DESTINATIONS>& modulation,
+                           std::array<float, NUM_MOD_DESTINATIONS>& carried) const;
+    void updateStaticModulation();
+    void updateSourceRouting();
+
+    // Settings the per-sample loop reads: the panel's, a snapshot's, or a crossfade
+    // between two of them. Cutoffs are also kept in octaves so crossfades sweep evenly
+    struct SoundSettings
+    {
+        float filter1Freq = 1000.0f;
+        float filter1Octaves = 0.0f;
+        float filter1Reso = 0.5f;
+        float filter1Morph = 0.0f;  // Tap position (mode and morph resolved)
+        FilterType filter1Type = FilterType::SVF;
+        float filter2Freq = 2000.0f;
+        float filter2Octaves = 0.0f;
+        float filter2Reso = 0.5f;
+        float filter2Morph = 0.0f;
+        FilterType filter2Type = FilterType::SVF;
+        float fmAmount = 0.0f;
+        float driveAmount = 0.0f;
+        DriveType driveType = DriveType::Soft;
+        float dryWetMix = 1.0f;
+        float amAmount = 0.0f;
+        float routingBalance = 0.5f;
+        float envAmount = 0.0f;
+        float lfoDepth = 0.0f;
+    };
+
+    // A stored snapshot, converted to what the per-sample loop reads when it is stored
+    struct PreparedSnapshot
+    {
+        SoundSettings sound;
+        ModRoutingTable routing;
+        bool stored = false;
+    };
+
+    SoundSettings sound;          // This sample's settings
+    SoundSettings panelSound;     // Gathered from the setters once per block
+    SoundSettings fadeFromSound;  // Crossfade start
+    const ModRoutingTable* fadeFromRouting = nullptr;  // Set while a crossfade blends two tables
+    std::array<PreparedSnapshot, NUM_SNAPSHOTS> snapshots;
+    SnapshotMode snapshotMode = SnapshotMode::Off;
+    int snapshotSelect = 0;
+    int snapshotCount = NUM_SNAPSHOTS;
+    NoteDivision snapshotDivision = NoteDivision::Div_1_1;
+    float snapshotFadeMs = 10.0f;
+    int activeSnapshot = -1;         // -1 = panel
+    float snapshotFade = 1.0f;       // Crossfade progress, 1 = done
+    float snapshotFadeIncrement = 0.0f;
+    double snapshotPpq = 0.0;        // Free-runs from here when the host is stopped
+    int snapshotSwitchSample = -1;   // Step mode: sample in this block where the next snapshot starts
+    int snapshotSwitchIndex = -1;
+
+    void updateSnapshots(int numSamples);
+    void startSnapshotFade(int index, float increment);
+    void advanceSnapshotFade();
+    int getPlayableSnapshot(int index) const;  // -1 (panel) for empty slots
+    const SoundSettings& getSnapshotSound(int index) const;
+    const ModRoutingTable& getSnapshotRouting(int index) const;
+    static SoundSettings blendSound(const SoundSettings& from, const SoundSettings& to, float position);
 
     // Parameters
     float inputGain = 1.0f;
     bool hiBoostEnabled = false;
     bool hiCutEnabled = false;
     bool limiterEnabled = false;
+    bool outputLimiterEnabled = false;
+    bool inputLimiterResetPending = false;   // Switched on since the last block: delays cleared
+    bool outputLimiterResetPending = false;  // at the top of processChunk
 
     float filter1BaseFreq = 1000.0f;
     float filter1BaseReso = 0.5f;
     float filter2BaseFreq = 2000.0f;
     float filter2BaseReso = 0.5f;
+    FilterType filter1BaseType = FilterType::SVF;
+    FilterType filter2BaseType = FilterType::SVF;
+    FilterMode filter1Mode = FilterMode::LowPass;
+    FilterMode filter2Mode = FilterMode::LowPass;
+    float filter1Morph = 0.0f;
+    float filter2Morph = 0.0f;
+    float filter1BaseMorph = 0.0f;  // Tap position from mode + morph (0-3)
+    float filter2BaseMorph = 0.0f;
+
+    std::array<std::array<TapOutputs, MAX_CHANNELS>, 2> tapOutputs;  // [filter][channel]
+    std::array<float*, MAX_CHANNELS> dryOutputs = {};
+    bool tapOutputsActive = false;
 
     float fmAmount = 0.0f;
+    bool expFreqMod = false;
+    bool resoCompEnabled = false;
+    std::array<float, 2> resoCompGain = {1.0f, 1.0f};    // Applied gain per filter, ramped per sample
+    std::array<float, 2> resoCompTarget = {1.0f, 1.0f};  // This block's gain
+    std::array<float, 2> resoCompStep = {};
+    std::array<float, 2> crossModAmount = {};  // [CrossModPath]
+    std::array<bool, 2> crossModExp = {};
+    bool crossModActive = false;
     float envAmount = 0.0f;
     float envSensitivity = 0.5f;
+    EnvTrigger envTrigger = EnvTrigger::Audio;
+    bool lfoRetrigger = false;
+    float noteVelocity = 0.0f;
+    float lookaheadMs = 0.0f;
+    int lookaheadSamples = 0;
+    bool lookaheadResetPending = false;  // Switched on since the last block
 
     float lfoDepth = 0.0f;
     float lfoBaseRate = 1.0f;
@@ -329,6 +1092,26 @@ private:
     NoteDivision lfo2Division = NoteDivision::Div_1_4;
 
     double hostBPM = 120.0;
+    double hostPpq = 0.0;
+    bool hostPlaying = false;
+
+    struct SequencerStep
+    {
+        float value = 1.0f;
+        bool gate = true;
+        bool glide = false;  // Ramp to the next step's value across this step
+    };
+    std::array<SequencerStep, MAX_SEQ_STEPS> sequencerSteps;
+    int sequencerLength = 16;
+    NoteDivision sequencerDivision = NoteDivision::Div_1_16;
+    float sequencerGateLength = 0.5f;
+    double sequencerPpq = 0.0;      // Free-runs from here when the host is stopped
+    int sequencerStep = 0;
+    float sequencerSlewState = -1.0f;
+    float sequencerSlewCoef = 0.0f;  // ~1 ms, softens gate edges
+    bool sequencerRouted = false;    // Only rendered when a slot uses it
+
+    void renderSequencer(int numSamples);
 
     float amAmount = 0.0f;
 
@@ -336,9 +1119,61 @@ private:
     DriveType driveType = DriveType::Soft;
     bool drivePost = true;  // Post-filter by default
 
-    bool parallelRouting = false;
+    FilterRouting filterRouting = FilterRouting::Series;
+    RoutingKernel routingKernel = &DualCoreDSP::routeSeries;
+    float routingBalance = 0.5f;
+    float feedbackAmount = 0.0f;
+    float feedbackDelayMs = 0.0f;
+    float splitFilter1Output = 0.0f;  // Split: an even channel's F1 output, the FM source for its odd partner
     float dryWetMix = 1.0f;
 
+    bool midSideEnabled = false;
+    bool sideLinked = true;
+    float sideFreqOffset = 0.0f;
+    float sideResoOffset = 0.0f;
+    float stereoSpread = 0.0f;
+
+    // Analog drift, ticked every DRIFT_INTERVAL samples across blocks
+    static constexpr int DRIFT_INTERVAL = 64;
+    float driftAmount = 0.0f;
+    uint32_t driftSeed = 0;
+    float driftWalkDecay = 0.0f;  // Per tick, for a ~3 s wander
+    float driftWalkNoise = 0.0f;
+    int driftCountdown = 0;
+    void seedDrift();
+
+    // Unison: voice 0 is the channel's own filter, voices 1..N-1 occupy lanes 0..N-2
+    struct UnisonLayout
+    {
+        float norm = 1.0f;  // Gain compensation (1/N)
+        alignas(32) float scale[FilterLanes::LANES] = {};       // Cutoff multiplier per lane
+        alignas(32) float resoOffset[FilterLanes::LANES] = {};
+        alignas(32) float laneGain[FilterLanes::LANES] = {};    // 0 for unused lanes
+    };
+
+    int unisonVoices = 1;
+    float unisonDetune = 0.0f;
+    float unisonResoSpread = 0.0f;
+    UnisonLayout unisonLayout;        // Applied, ramped per sample
+    UnisonLayout unisonTarget;        // Set by setUnison
+    UnisonLayout unisonStep;          // Per sample (norm is derived from the lane gains)
+    bool unisonLayoutChanged = false;
+    bool unisonRamping = false;       // The bank keeps running while fading out to one voice
+
+    void updateUnisonRamp(int numSamples);
+    void advanceUnisonRamp();
+
+    int numBands = 1;
+    std::array<float, MAX_BANDS - 1> crossoverFrequencies = {200.0f, 1000.0f, 5000.0f};
+    alignas(32) float bandCutoffScale[FilterLanes::LANES] = {1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f};
+    float bandDrive[MAX_BANDS] = {};
+    float bandMix[MAX_BANDS] = {1.0f, 1.0f, 1.0f, 1.0f};
+
+    bool polyMode = false;
+    float keyTracking = 1.0f;
+    alignas(32) float polyCutoffScale[MAX_POLY_VOICES] = {};   // Key tracking (and env in octave mode)
+    alignas(32) float polyCutoffOffset[MAX_POLY_VOICES] = {};  // Envelope in Hz (linear mode)
+
     // State
     double sampleRate = 44100.0;
     bool envTriggered = false;
@@ -118,37 +118,43 @@ void FilterResponseDisplay::resized()
     updateResponseCurves();
 }
 
-void FilterResponseDisplay::setFilter1Parameters(float frequency, float resonance, int mode, int type)
+void FilterResponseDisplay::setFilter1Parameters(float frequency, float resonance, int mode, int type, float morph)
 {
-    if (filter1Freq != frequency || filter1Reso != resonance || filter1Mode != mode || filter1Type != type)
+    if (filter1Freq != frequency || filter1Reso != resonance || filter1Mode != mode || filter1Type != type
+        || filter1Morph != morph)
     {
         filter1Freq = frequency;
         filter1Reso = resonance;
         filter1Mode = mode;
         filter1Type = type;
+        filter1Morph = morph;
         updateResponseCurves();
         repaint();
     }
 }
 
-void FilterResponseDisplay::setFilter2Parameters(float frequency, float resonance, int mode, int type)
+void FilterResponseDisplay::setFilter2Parameters(float frequency, float resonance, int mode, int type, float morph)
 {
-    if (filter2Freq != frequency || filter2Reso != resonance || filter2Mode != mode || filter2Type != type)
+    if (filter2Freq != frequency || filter2Reso != resonance || filter2Mode != mode || filter2Type != type
+        || filter2Morph != morph)
     {
         filter2Freq = frequency;
         filter2Reso = resonance;
         filter2Mode = mode;
         filter2Type = type;
+        filter2Morph = morph;
         updateResponseCurves();
         repaint();
     }
 }
 
-void FilterResponseDisplay::setParallelMode(bool parallel)
+void FilterResponseDisplay::setRouting(int routing, float balance, float feedback)
 {
-    if (parallelRouting != parallel)
+    if (routingMode != routing || routingBalance != balance || feedbackAmount != feedback)
     {
-        parallelRouting = parallel;
+        routingMode = routing;
+        routingBalance = balance;
+        feedbackAmount = feedback;
         updateResponseCurves();
         repaint();
     }
@@ -291,6 +297,22 @@ float FilterResponseDisplay::calculateFilterMagnitude(float freq, float filterFr
     return magnitude;
 }
 
+float FilterResponseDisplay::calculateMorphMagnitude(float freq, float filterFreq, float resonance, int mode, int type, float morph)
+{
+    if (mode != 4)
+        return calculateFilterMagnitude(freq, filterFreq, resonance, mode, type);
+
+    // Morph position 0-3 walks LP -> BP -> HP -> Notch (mode indices 0, 2, 1, 3)
+    static constexpr int morphOrder[4] = {0, 2, 1, 3};
+    float position = juce::jlimit(0.0f, 1.0f, morph) * 3.0f;
+    int index = juce::jlimit(0, 2, static_cast<int>(position));
+    float frac = position - static_cast<float>(index);
+
+    float from = calculateFilterMagnitude(freq, filterFreq, resonance, morphOrder[index], type);
+    float to = calculateFilterMagnitude(freq, filterFreq, resonance, morphOrder[index + 1], type);
+    return from + (to - from) * frac;
+}
+
 float FilterResponseDisplay::freqToX(float freq, float width)
 {
     // Logarithmic mapping from 20Hz to 20kHz
@@ -327,8 +349,8 @@ void FilterResponseDisplay::updateResponseCurves()
         float freq = minFreq * std::pow(maxFreq / minFreq, t);
 
         // Calculate magnitudes with filter type
-        float mag1 = calculateFilterMagnitude(freq, filter1Freq, filter1Reso, filter1Mode, filter1Type);
-        float mag2 = calculateFilterMagnitude(freq, filter2Freq, filter2Reso, filter2Mode, filter2Type);
+        float mag1 = calculateMorphMagnitude(freq, filter1Freq, filter1Reso, filter1Mode, filter1Type, filter1Morph);
+        float mag2 = calculateMorphMagnitude(freq, filter2Freq, filter2Reso, filter2Mode, filter2Type, filter2Morph);
 
         // Convert to dB
         float db1 = 20.0f * std::log10(juce::jmax(0.0001f, mag1));
@@ -339,15 +361,36 @@ void FilterResponseDisplay::updateResponseCurves()
 
         // Combined response depends on routing
         float combinedMag;
-        if (parallelRouting)
-        {
-            // Parallel: average of both
-            combinedMag = (mag1 + mag2) * 0.5f;
-        }
-        else
+        switch (routingMode)
         {
-            // Series: multiply magnitudes
-            combinedMag = mag1 * mag2;
+            case 1:
+                // Parallel: balance-weighted sum
+                combinedMag = mag1 * (1.0f - routingBalance) + mag2 * routingBalance;
+                break;
+
+            case 2:
+                // Split: each filter hears half the channels, so show the average
+                combinedMag = (mag1 + mag2) * 0.5f;
+                break;
+
+            case 3:
+            {
+                // Feedback: series pair in a loop. Magnitude only, so this is the
+                // in-phase (worst case) peak; the denominator is kept off zero
+                float series = mag1 * mag2;
+                combinedMag = series / juce::jmax(0.05f, 1.0f - feedbackAmount * series);
+                break;
+            }
+
+            case 4:
+                // Cascade: the series pair twice
+                combinedMag = mag1 * mag2 * mag1 * mag2;
+                break;
+
+            default:
+                // Series: multiply magnitudes
+                combinedMag = mag1 * mag2;
+                break;
         }
 
         float dbCombined = 20.0f * std::log10(juce::jmax(0.0001f, combinedMag));
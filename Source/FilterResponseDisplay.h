@@ -12,14 +12,17 @@ public:
     void resized() override;
 
     // Update filter parameters
-    void setFilter1Parameters(float frequency, float resonance, int mode, int type);
-    void setFilter2Parameters(float frequency, float resonance, int mode, int type);
-    void setParallelMode(bool parallel);
+    void setFilter1Parameters(float frequency, float resonance, int mode, int type, float morph);
+    void setFilter2Parameters(float frequency, float resonance, int mode, int type, float morph);
+    void setRouting(int routing, float balance, float feedback);  // routing: 0=Series, 1=Parallel, 2=Split, 3=Feedback, 4=Cascade
 
 private:
     // Calculate magnitude response for different filter types
     float calculateFilterMagnitude(float freq, float filterFreq, float resonance, int mode, int type);
 
+    // Morph mode blends neighbouring responses (LP -> BP -> HP -> Notch)
+    float calculateMorphMagnitude(float freq, float filterFreq, float resonance, int mode, int type, float morph);
+
     // Convert frequency to X position (logarithmic)
     float freqToX(float freq, float width);
 
@@ -29,15 +32,19 @@ private:
     // Filter parameters
     float filter1Freq = 1000.0f;
     float filter1Reso = 0.5f;
-    int filter1Mode = 0;  // 0=LP, 1=HP, 2=BP, 3=Notch
+    int filter1Mode = 0;  // 0=LP, 1=HP, 2=BP, 3=Notch, 4=Morph
     int filter1Type = 0;  // 0=SVF, 1=Ladder, 2=Diode, 3=MS20, 4=Steiner, 5=OTA
+    float filter1Morph = 0.0f;
 
     float filter2Freq = 2000.0f;
     float filter2Reso = 0.5f;
     int filter2Mode = 0;
     int filter2Type = 0;
+    float filter2Morph = 0.0f;
 
-    bool parallelRouting = false;
+    int routingMode = 0;
+    float routingBalance = 0.5f;
+    float feedbackAmount = 0.0f;
 
     // Cached response curves
     std::vector<float> filter1Response;
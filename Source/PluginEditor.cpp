@@ -13,15 +13,25 @@ DualCoreAudioProcessorEditor::DualCoreAudioProcessorEditor(DualCoreAudioProcesso
     setupToggle(hiBoostButton, "HI BOOST");
     setupToggle(hiCutButton, "HI CUT");
     setupToggle(limiterButton, "LIMIT");
+    setupSlider(limiterCeilingSlider, limiterCeilingLabel, "CEIL");
+    setupToggle(outputLimiterButton, "OUT LIMIT");
+    setupToggle(excludeCentreLFEButton, "SKIP C/LFE");
+
+    auxModeBox.addItem("F1/F2/Dry", 1);
+    auxModeBox.addItem("F1 Taps", 2);
+    auxModeBox.addItem("F2 Taps", 3);
+    addAndMakeVisible(auxModeBox);
 
     // === Filter 1 ===
     setupSlider(filter1FreqSlider, filter1FreqLabel, "FREQ 1");
     setupSlider(filter1ResoSlider, filter1ResoLabel, "RESO 1");
+    setupSlider(filter1MorphSlider, filter1MorphLabel, "MORPH");
 
     filter1ModeBox.addItem("LP", 1);
     filter1ModeBox.addItem("HP", 2);
     filter1ModeBox.addItem("BP", 3);
     filter1ModeBox.addItem("NOTCH", 4);
+    filter1ModeBox.addItem("MORPH", 5);
     addAndMakeVisible(filter1ModeBox);
 
     filter1TypeBox.addItem("SVF", 1);
@@ -35,11 +45,13 @@ DualCoreAudioProcessorEditor::DualCoreAudioProcessorEditor(DualCoreAudioProcesso
     // === Filter 2 ===
     setupSlider(filter2FreqSlider, filter2FreqLabel, "FREQ 2");
     setupSlider(filter2ResoSlider, filter2ResoLabel, "RESO 2");
+    setupSlider(filter2MorphSlider, filter2MorphLabel, "MORPH");
 
     filter2ModeBox.addItem("LP", 1);
     filter2ModeBox.addItem("HP", 2);
     filter2ModeBox.addItem("BP", 3);
     filter2ModeBox.addItem("NOTCH", 4);
+    filter2ModeBox.addItem("MORPH", 5);
     addAndMakeVisible(filter2ModeBox);
 
     filter2TypeBox.addItem("SVF", 1);
@@ -50,8 +62,15 @@ DualCoreAudioProcessorEditor::DualCoreAudioProcessorEditor(DualCoreAudioProcesso
     filter2TypeBox.addItem("OTA", 6);
     addAndMakeVisible(filter2TypeBox);
 
+    setupToggle(resoCompButton, "RESO COMP");
+
     // === FM ===
     setupSlider(fmAmountSlider, fmAmountLabel, "FM");
+    setupToggle(expFreqModButton, "EXP");
+
+    fmSourceBox.addItem("F1 Out", 1);
+    fmSourceBox.addItem("SC", 2);
+    addAndMakeVisible(fmSourceBox);
 
     // === ADSR Envelope ===
     setupSlider(envAttackSlider, envAttackLabel, "A");
@@ -60,10 +79,21 @@ DualCoreAudioProcessorEditor::DualCoreAudioProcessorEditor(DualCoreAudioProcesso
     setupSlider(envReleaseSlider, envReleaseLabel, "R");
     setupSlider(envAmountSlider, envAmountLabel, "AMT");
     setupSlider(envSensSlider, envSensLabel, "SENS");
+    setupSlider(lookaheadSlider, lookaheadLabel, "LOOK");
+
+    detectorSourceBox.addItem("Main In", 1);
+    detectorSourceBox.addItem("Sidechain", 2);
+    addAndMakeVisible(detectorSourceBox);
+
+    envTriggerBox.addItem("Audio", 1);
+    envTriggerBox.addItem("MIDI", 2);
+    envTriggerBox.addItem("Both", 3);
+    addAndMakeVisible(envTriggerBox);
 
     // === LFO1 ===
     setupSlider(lfoRateSlider, lfoRateLabel, "RATE");
     setupSlider(lfoDepthSlider, lfoDepthLabel, "DEPTH");
+    setupSlider(lfoAudioRateSlider, lfoAudioRateLabel, "AUDIO");
 
     lfoWaveBox.addItem("Sine", 1);
     lfoWaveBox.addItem("Tri", 2);
@@ -101,6 +131,7 @@ DualCoreAudioProcessorEditor::DualCoreAudioProcessorEditor(DualCoreAudioProcesso
     // === LFO2 ===
     setupSlider(lfo2RateSlider, lfo2RateLabel, "RATE");
     setupSlider(lfo2DepthSlider, lfo2DepthLabel, "DEPTH");
+    setupSlider(lfo2AudioRateSlider, lfo2AudioRateLabel, "AUDIO");
 
     lfo2WaveBox.addItem("Sine", 1);
     lfo2WaveBox.addItem("Tri", 2);
@@ -131,9 +162,12 @@ DualCoreAudioProcessorEditor::DualCoreAudioProcessorEditor(DualCoreAudioProcesso
     addAndMakeVisible(lfo2DivBox);
 
     // === Modulation Matrix ===
-    juce::StringArray modSources{"None", "LFO1", "LFO2", "Env", "Input"};
+    juce::StringArray modSources{"None", "LFO1", "LFO2", "Env", "Input", "Vel", "Seq", "Low", "Mid", "High", "Bright"};
     juce::StringArray modDests{"None", "F1 Freq", "F1 Reso", "F2 Freq", "F2 Reso",
-                               "FM", "Drive", "LFO1 Rate", "LFO2 Rate", "Mix", "AM"};
+                               "FM", "Drive", "LFO1 Rate", "LFO2 Rate", "Mix", "AM",
+                               "F1 Type", "F2 Type", "F1 Morph", "F2 Morph",
+                               "LFO1 Depth", "Env Amt", "Slot1 Amt", "Slot2 Amt",
+                               "Slot3 Amt", "Slot4 Amt", "Slot5 Amt", "Slot6 Amt"};
 
     for (int i = 0; i < 6; ++i)
     {
@@ -153,6 +187,17 @@ DualCoreAudioProcessorEditor::DualCoreAudioProcessorEditor(DualCoreAudioProcesso
         addAndMakeVisible(slot.amountSlider);
     }
 
+    // === Input EQ ===
+    const juce::StringArray eqBandNames{"LOW", "MID1", "MID2", "HIGH"};
+
+    for (int i = 0; i < 4; ++i)
+    {
+        auto& band = eqBandUIs[i];
+        setupSlider(band.freqSlider, band.freqLabel, eqBandNames[i] + " F");
+        setupSlider(band.gainSlider, band.gainLabel, eqBandNames[i] + " G");
+        setupSlider(band.qSlider, band.qLabel, eqBandNames[i] + " Q");
+    }
+
     // === AM ===
     setupSlider(amAmountSlider, amAmountLabel, "AM");
     setupSlider(amAttackSlider, amAttackLabel, "A");
@@ -166,13 +211,143 @@ DualCoreAudioProcessorEditor::DualCoreAudioProcessorEditor(DualCoreAudioProcesso
     driveTypeBox.addItem("Tape", 3);
     driveTypeBox.addItem("Hard", 4);
     driveTypeBox.addItem("Fuzz", 5);
+    driveTypeBox.addItem("Fold", 6);
+    driveTypeBox.addItem("Crush", 7);
     addAndMakeVisible(driveTypeBox);
 
     setupToggle(drivePrePostButton, "POST");
 
     // === Routing ===
-    setupToggle(routingButton, "PARALLEL");
+    routingBox.addItem("Series", 1);
+    routingBox.addItem("Parallel", 2);
+    routingBox.addItem("Split L/R", 3);
+    routingBox.addItem("Feedback", 4);
+    routingBox.addItem("Cascade", 5);
+    addAndMakeVisible(routingBox);
+
     setupSlider(mixSlider, mixLabel, "MIX");
+    setupSlider(routingBalanceSlider, routingBalanceLabel, "BAL");
+    setupSlider(feedbackAmountSlider, feedbackAmountLabel, "FB");
+    setupSlider(feedbackDelaySlider, feedbackDelayLabel, "DLY");
+
+    // === Stereo ===
+    setupToggle(midSideButton, "M/S");
+    setupToggle(sideLinkButton, "LINK");
+    setupSlider(sideFreqOffsetSlider, sideFreqOffsetLabel, "S FREQ");
+    setupSlider(sideResoOffsetSlider, sideResoOffsetLabel, "S RESO");
+    setupSlider(stereoSpreadSlider, stereoSpreadLabel, "SPREAD");
+    setupSlider(driftSlider, driftLabel, "DRIFT");
+
+    // === Unison ===
+    setupSlider(unisonVoicesSlider, unisonVoicesLabel, "VOICES");
+    setupSlider(unisonDetuneSlider, unisonDetuneLabel, "DETUNE");
+    setupSlider(unisonResoSpreadSlider, unisonResoSpreadLabel, "RESO");
+
+    // === Poly ===
+    setupToggle(polyModeButton, "POLY");
+    setupToggle(lfoRetriggerButton, "RETRIG");
+    setupSlider(keyTrackSlider, keyTrackLabel, "KEY");
+
+    // === Cross-Mod ===
+    setupSlider(fmReturnSlider, fmReturnLabel, "F2>F1");
+    setupSlider(selfFMSlider, selfFMLabel, "SELF");
+    setupToggle(fmReturnExpButton, "F2>F1 EXP");
+    setupToggle(selfFMExpButton, "SELF EXP");
+
+    // === Multiband ===
+    bandCountBox.addItem("Off", 1);
+    bandCountBox.addItem("2 Bands", 2);
+    bandCountBox.addItem("3 Bands", 3);
+    bandCountBox.addItem("4 Bands", 4);
+    addAndMakeVisible(bandCountBox);
+
+    const juce::StringArray crossoverNames{"X LO", "X MID", "X HI"};
+    for (int i = 0; i < 3; ++i)
+        setupSlider(crossoverSliders[i], crossoverLabels[i], crossoverNames[i]);
+
+    for (int i = 0; i < 4; ++i)
+    {
+        auto& band = bandUIs[i];
+        const juce::String prefix = "B" + juce::String(i + 1) + " ";
+        setupSlider(band.offsetSlider, band.offsetLabel, prefix + "FRQ");
+        setupSlider(band.driveSlider, band.driveLabel, prefix + "DRV");
+        setupSlider(band.mixSlider, band.mixLabel, prefix + "MIX");
+    }
+
+    // === Macros ===
+    for (int i = 0; i < 8; ++i)
+        setupSlider(macroSliders[i], macroLabels[i], "M" + juce::String(i + 1));
+
+    for (int i = 1; i <= 16; ++i)
+        macroTargetBox.addItem("T" + juce::String(i), i);
+    macroTargetBox.onChange = [this] { showMacroTarget(macroTargetBox.getSelectedItemIndex()); };
+    addAndMakeVisible(macroTargetBox);
+
+    macroSourceBox.addItem("None", 1);
+    for (int i = 1; i <= 8; ++i)
+        macroSourceBox.addItem("M" + juce::String(i), i + 1);
+    addAndMakeVisible(macroSourceBox);
+
+    for (const auto& dst : modDests)
+        macroDestBox.addItem(dst, macroDestBox.getNumItems() + 1);
+    addAndMakeVisible(macroDestBox);
+
+    setupSlider(macroMinSlider, macroMinLabel, "MIN");
+    setupSlider(macroMaxSlider, macroMaxLabel, "MAX");
+    setupSlider(macroCurveSlider, macroCurveLabel, "CURVE");
+
+    // === Step Sequencer ===
+    setupSlider(seqLengthSlider, seqLengthLabel, "STEPS");
+    setupSlider(seqGateLengthSlider, seqGateLengthLabel, "GATE");
+
+    const juce::StringArray divisions{"4/1", "2/1", "1/1", "1/2", "1/4", "1/8", "1/16", "1/32",
+                                      "1/2T", "1/4T", "1/8T", "1/16T", "1/2D", "1/4D", "1/8D", "1/16D"};
+    for (const auto& division : divisions)
+        seqRateBox.addItem(division, seqRateBox.getNumItems() + 1);
+    addAndMakeVisible(seqRateBox);
+
+    stepSequencerDisplay.onValueChange = [this](int step, float value)
+    {
+        setParameterFromUI("seqValue" + juce::String(step + 1), std::round(value * 100.0f));
+    };
+    stepSequencerDisplay.onGateChange = [this](int step, bool gate)
+    {
+        setParameterFromUI("seqGate" + juce::String(step + 1), gate ? 1.0f : 0.0f);
+    };
+    stepSequencerDisplay.onGlideChange = [this](int step, bool glide)
+    {
+        setParameterFromUI("seqGlide" + juce::String(step + 1), glide ? 1.0f : 0.0f);
+    };
+    addAndMakeVisible(stepSequencerDisplay);
+
+    // === Snapshots ===
+    for (const auto& mode : {"Off", "Manual", "Step", "Glide"})
+        snapshotModeBox.addItem(mode, snapshotModeBox.getNumItems() + 1);
+    addAndMakeVisible(snapshotModeBox);
+
+    for (int i = 0; i < DualCoreDSP::NUM_SNAPSHOTS; ++i)
+    {
+        auto& button = snapshotButtons[static_cast<size_t>(i)];
+        button.setButtonText("S" + juce::String(i + 1));
+        button.onClick = [this, i] { snapshotButtonClicked(i); };
+        addAndMakeVisible(button);
+    }
+
+    snapshotStoreButton.setButtonText("STORE");
+    snapshotStoreButton.setClickingTogglesState(true);
+    snapshotStoreButton.onClick = [this] { snapshotClearButton.setToggleState(false, juce::dontSendNotification); };
+    addAndMakeVisible(snapshotStoreButton);
+
+    snapshotClearButton.setButtonText("CLEAR");
+    snapshotClearButton.setClickingTogglesState(true);
+    snapshotClearButton.onClick = [this] { snapshotStoreButton.setToggleState(false, juce::dontSendNotification); };
+    addAndMakeVisible(snapshotClearButton);
+
+    setupSlider(snapshotCountSlider, snapshotCountLabel, "COUNT");
+    setupSlider(snapshotFadeSlider, snapshotFadeLabel, "FADE");
+    for (const auto& division : divisions)
+        snapshotRateBox.addItem(division, snapshotRateBox.getNumItems() + 1);
+    addAndMakeVisible(snapshotRateBox);
 
     // === Filter Response Display ===
     addAndMakeVisible(filterResponseDisplay);
@@ -203,6 +378,14 @@ DualCoreAudioProcessorEditor::DualCoreAudioProcessorEditor(DualCoreAudioProcesso
         audioProcessor.apvts, "hiCut", hiCutButton);
     limiterAttachment = std::make_unique<juce::AudioProcessorValueTreeState::ButtonAttachment>(
         audioProcessor.apvts, "limiter", limiterButton);
+    limiterCeilingAttachment = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(
+        audioProcessor.apvts, "limiterCeiling", limiterCeilingSlider);
+    outputLimiterAttachment = std::make_unique<juce::AudioProcessorValueTreeState::ButtonAttachment>(
+        audioProcessor.apvts, "outputLimiter", outputLimiterButton);
+    excludeCentreLFEAttachment = std::make_unique<juce::AudioProcessorValueTreeState::ButtonAttachment>(
+        audioProcessor.apvts, "excludeCentreLfe", excludeCentreLFEButton);
+    auxModeAttachment = std::make_unique<juce::AudioProcessorValueTreeState::ComboBoxAttachment>(
+        audioProcessor.apvts, "auxMode", auxModeBox);
 
     filter1FreqAttachment = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(
         audioProcessor.apvts, "filter1Freq", filter1FreqSlider);
@@ -212,6 +395,8 @@ DualCoreAudioProcessorEditor::DualCoreAudioProcessorEditor(DualCoreAudioProcesso
         audioProcessor.apvts, "filter1Mode", filter1ModeBox);
     filter1TypeAttachment = std::make_unique<juce::AudioProcessorValueTreeState::ComboBoxAttachment>(
         audioProcessor.apvts, "filter1Type", filter1TypeBox);
+    filter1MorphAttachment = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(
+        audioProcessor.apvts, "filter1Morph", filter1MorphSlider);
 
     filter2FreqAttachment = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(
         audioProcessor.apvts, "filter2Freq", filter2FreqSlider);
@@ -221,9 +406,17 @@ DualCoreAudioProcessorEditor::DualCoreAudioProcessorEditor(DualCoreAudioProcesso
         audioProcessor.apvts, "filter2Mode", filter2ModeBox);
     filter2TypeAttachment = std::make_unique<juce::AudioProcessorValueTreeState::ComboBoxAttachment>(
         audioProcessor.apvts, "filter2Type", filter2TypeBox);
+    filter2MorphAttachment = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(
+        audioProcessor.apvts, "filter2Morph", filter2MorphSlider);
+    resoCompAttachment = std::make_unique<juce::AudioProcessorValueTreeState::ButtonAttachment>(
+        audioProcessor.apvts, "resoComp", resoCompButton);
 
     fmAmountAttachment = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(
         audioProcessor.apvts, "fmAmount", fmAmountSlider);
+    expFreqModAttachment = std::make_unique<juce::AudioProcessorValueTreeState::ButtonAttachment>(
+        audioProcessor.apvts, "expFreqMod", expFreqModButton);
+    fmSourceAttachment = std::make_unique<juce::AudioProcessorValueTreeState::ComboBoxAttachment>(
+        audioProcessor.apvts, "fmSource", fmSourceBox);
 
     envAttackAttachment = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(
         audioProcessor.apvts, "envAttack", envAttackSlider);
@@ -237,6 +430,12 @@ DualCoreAudioProcessorEditor::DualCoreAudioProcessorEditor(DualCoreAudioProcesso
         audioProcessor.apvts, "envAmount", envAmountSlider);
     envSensAttachment = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(
         audioProcessor.apvts, "envSens", envSensSlider);
+    lookaheadAttachment = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(
+        audioProcessor.apvts, "lookahead", lookaheadSlider);
+    detectorSourceAttachment = std::make_unique<juce::AudioProcessorValueTreeState::ComboBoxAttachment>(
+        audioProcessor.apvts, "detectorSource", detectorSourceBox);
+    envTriggerAttachment = std::make_unique<juce::AudioProcessorValueTreeState::ComboBoxAttachment>(
+        audioProcessor.apvts, "envTrigger", envTriggerBox);
 
     lfoRateAttachment = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(
         audioProcessor.apvts, "lfoRate", lfoRateSlider);
@@ -250,6 +449,8 @@ DualCoreAudioProcessorEditor::DualCoreAudioProcessorEditor(DualCoreAudioProcesso
         audioProcessor.apvts, "lfoSync", lfoSyncButton);
     lfoDivAttachment = std::make_unique<juce::AudioProcessorValueTreeState::ComboBoxAttachment>(
         audioProcessor.apvts, "lfoDiv", lfoDivBox);
+    lfoAudioRateAttachment = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(
+        audioProcessor.apvts, "lfoAudioRate", lfoAudioRateSlider);
 
     lfo2RateAttachment = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(
         audioProcessor.apvts, "lfo2Rate", lfo2RateSlider);
@@ -261,6 +462,8 @@ DualCoreAudioProcessorEditor::DualCoreAudioProcessorEditor(DualCoreAudioProcesso
         audioProcessor.apvts, "lfo2Sync", lfo2SyncButton);
     lfo2DivAttachment = std::make_unique<juce::AudioProcessorValueTreeState::ComboBoxAttachment>(
         audioProcessor.apvts, "lfo2Div", lfo2DivBox);
+    lfo2AudioRateAttachment = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(
+        audioProcessor.apvts, "lfo2AudioRate", lfo2AudioRateSlider);
 
     // Modulation Matrix Attachments
     for (int i = 0; i < 6; ++i)
@@ -274,6 +477,19 @@ DualCoreAudioProcessorEditor::DualCoreAudioProcessorEditor(DualCoreAudioProcesso
             audioProcessor.apvts, "modAmount" + slotNum, modSlotUIs[i].amountSlider);
     }
 
+    // Input EQ Attachments
+    const juce::StringArray eqBandIDs{"eqLow", "eqMid1", "eqMid2", "eqHigh"};
+
+    for (int i = 0; i < 4; ++i)
+    {
+        eqBandAttachments[i].freqAttachment = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(
+            audioProcessor.apvts, eqBandIDs[i] + "Freq", eqBandUIs[i].freqSlider);
+        eqBandAttachments[i].gainAttachment = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(
+            audioProcessor.apvts, eqBandIDs[i] + "Gain", eqBandUIs[i].gainSlider);
+        eqBandAttachments[i].qAttachment = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(
+            audioProcessor.apvts, eqBandIDs[i] + "Q", eqBandUIs[i].qSlider);
+    }
+
     amAmountAttachment = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(
         audioProcessor.apvts, "amAmount", amAmountSlider);
     amAttackAttachment = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(
@@ -288,10 +504,100 @@ DualCoreAudioProcessorEditor::DualCoreAudioProcessorEditor(DualCoreAudioProcesso
     drivePrePostAttachment = std::make_unique<juce::AudioProcessorValueTreeState::ButtonAttachment>(
         audioProcessor.apvts, "drivePrePost", drivePrePostButton);
 
-    routingAttachment = std::make_unique<juce::AudioProcessorValueTreeState::ButtonAttachment>(
-        audioProcessor.apvts, "routing", routingButton);
+    routingAttachment = std::make_unique<juce::AudioProcessorValueTreeState::ComboBoxAttachment>(
+        audioProcessor.apvts, "routing", routingBox);
     mixAttachment = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(
         audioProcessor.apvts, "mix", mixSlider);
+    routingBalanceAttachment = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(
+        audioProcessor.apvts, "routingBalance", routingBalanceSlider);
+    feedbackAmountAttachment = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(
+        audioProcessor.apvts, "feedbackAmount", feedbackAmountSlider);
+    feedbackDelayAttachment = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(
+        audioProcessor.apvts, "feedbackDelay", feedbackDelaySlider);
+
+    midSideAttachment = std::make_unique<juce::AudioProcessorValueTreeState::ButtonAttachment>(
+        audioProcessor.apvts, "midSide", midSideButton);
+    sideLinkAttachment = std::make_unique<juce::AudioProcessorValueTreeState::ButtonAttachment>(
+        audioProcessor.apvts, "sideLink", sideLinkButton);
+    sideFreqOffsetAttachment = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(
+        audioProcessor.apvts, "sideFreqOffset", sideFreqOffsetSlider);
+    sideResoOffsetAttachment = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(
+        audioProcessor.apvts, "sideResoOffset", sideResoOffsetSlider);
+    stereoSpreadAttachment = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(
+        audioProcessor.apvts, "stereoSpread", stereoSpreadSlider);
+    driftAttachment = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(
+        audioProcessor.apvts, "drift", driftSlider);
+
+    unisonVoicesAttachment = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(
+        audioProcessor.apvts, "unisonVoices", unisonVoicesSlider);
+    unisonDetuneAttachment = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(
+        audioProcessor.apvts, "unisonDetune", unisonDetuneSlider);
+    unisonResoSpreadAttachment = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(
+        audioProcessor.apvts, "unisonResoSpread", unisonResoSpreadSlider);
+
+    polyModeAttachment = std::make_unique<juce::AudioProcessorValueTreeState::ButtonAttachment>(
+        audioProcessor.apvts, "polyMode", polyModeButton);
+    lfoRetriggerAttachment = std::make_unique<juce::AudioProcessorValueTreeState::ButtonAttachment>(
+        audioProcessor.apvts, "lfoRetrigger", lfoRetriggerButton);
+    keyTrackAttachment = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(
+        audioProcessor.apvts, "keyTrack", keyTrackSlider);
+
+    fmReturnAttachment = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(
+        audioProcessor.apvts, "fmReturn", fmReturnSlider);
+    selfFMAttachment = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(
+        audioProcessor.apvts, "selfFM", selfFMSlider);
+    fmReturnExpAttachment = std::make_unique<juce::AudioProcessorValueTreeState::ButtonAttachment>(
+        audioProcessor.apvts, "fmReturnExp", fmReturnExpButton);
+    selfFMExpAttachment = std::make_unique<juce::AudioProcessorValueTreeState::ButtonAttachment>(
+        audioProcessor.apvts, "selfFMExp", selfFMExpButton);
+
+    // Multiband Attachments
+    bandCountAttachment = std::make_unique<juce::AudioProcessorValueTreeState::ComboBoxAttachment>(
+        audioProcessor.apvts, "bandCount", bandCountBox);
+
+    const juce::StringArray crossoverIDs{"crossoverLow", "crossoverMid", "crossoverHigh"};
+    for (int i = 0; i < 3; ++i)
+    {
+        crossoverAttachments[i] = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(
+            audioProcessor.apvts, crossoverIDs[i], crossoverSliders[i]);
+    }
+
+    for (int i = 0; i < 4; ++i)
+    {
+        const juce::String bandID = "band" + juce::String(i + 1);
+        bandAttachments[i].offsetAttachment = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(
+            audioProcessor.apvts, bandID + "Offset", bandUIs[i].offsetSlider);
+        bandAttachments[i].driveAttachment = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(
+            audioProcessor.apvts, bandID + "Drive", bandUIs[i].driveSlider);
+        bandAttachments[i].mixAttachment = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(
+            audioProcessor.apvts, bandID + "Mix", bandUIs[i].mixSlider);
+    }
+
+    // Macro Attachments
+    for (int i = 0; i < 8; ++i)
+    {
+        macroAttachments[i] = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(
+            audioProcessor.apvts, "macro" + juce::String(i + 1), macroSliders[i]);
+    }
+    macroTargetBox.setSelectedItemIndex(0, juce::sendNotificationSync);
+
+    // Step Sequencer Attachments
+    seqLengthAttachment = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(
+        audioProcessor.apvts, "seqLength", seqLengthSlider);
+    seqGateLengthAttachment = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(
+        audioProcessor.apvts, "seqGateLength", seqGateLengthSlider);
+    seqRateAttachment = std::make_unique<juce::AudioProcessorValueTreeState::ComboBoxAttachment>(
+        audioProcessor.apvts, "seqRate", seqRateBox);
+
+    // Snapshot Attachments
+    snapshotModeAttachment = std::make_unique<juce::AudioProcessorValueTreeState::ComboBoxAttachment>(
+        audioProcessor.apvts, "snapshotMode", snapshotModeBox);
+    snapshotCountAttachment = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(
+        audioProcessor.apvts, "snapshotCount", snapshotCountSlider);
+    snapshotRateAttachment = std::make_unique<juce::AudioProcessorValueTreeState::ComboBoxAttachment>(
+        audioProcessor.apvts, "snapshotRate", snapshotRateBox);
+    snapshotFadeAttachment = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(
+        audioProcessor.apvts, "snapshotFade", snapshotFadeSlider);
 
     refreshPresetList();
     setUIScale(currentScale);
@@ -348,17 +654,47 @@ void DualCoreAudioProcessorEditor::timerCallback()
     float f1Reso = *audioProcessor.apvts.getRawParameterValue("filter1Reso");
     int f1Mode = static_cast<int>(*audioProcessor.apvts.getRawParameterValue("filter1Mode"));
     int f1Type = static_cast<int>(*audioProcessor.apvts.getRawParameterValue("filter1Type"));
+    float f1Morph = *audioProcessor.apvts.getRawParameterValue("filter1Morph");
 
     float f2Freq = *audioProcessor.apvts.getRawParameterValue("filter2Freq");
     float f2Reso = *audioProcessor.apvts.getRawParameterValue("filter2Reso");
     int f2Mode = static_cast<int>(*audioProcessor.apvts.getRawParameterValue("filter2Mode"));
     int f2Type = static_cast<int>(*audioProcessor.apvts.getRawParameterValue("filter2Type"));
+    float f2Morph = *audioProcessor.apvts.getRawParameterValue("filter2Morph");
 
-    bool parallel = *audioProcessor.apvts.getRawParameterValue("routing") > 0.5f;
+    int routing = static_cast<int>(*audioProcessor.apvts.getRawParameterValue("routing"));
+    float balance = *audioProcessor.apvts.getRawParameterValue("routingBalance");
+    float feedback = *audioProcessor.apvts.getRawParameterValue("feedbackAmount");
 
-    filterResponseDisplay.setFilter1Parameters(f1Freq, f1Reso, f1Mode, f1Type);
-    filterResponseDisplay.setFilter2Parameters(f2Freq, f2Reso, f2Mode, f2Type);
-    filterResponseDisplay.setParallelMode(parallel);
+    filterResponseDisplay.setFilter1Parameters(f1Freq, f1Reso, f1Mode, f1Type, f1Morph);
+    filterResponseDisplay.setFilter2Parameters(f2Freq, f2Reso, f2Mode, f2Type, f2Morph);
+    filterResponseDisplay.setRouting(routing, balance, feedback);
+
+    // Update step sequencer display
+    stepSequencerDisplay.setLength(static_cast<int>(*audioProcessor.apvts.getRawParameterValue("seqLength")));
+    for (int i = 0; i < StepSequencerDisplay::MAX_STEPS; ++i)
+    {
+        const juce::String stepNum(i + 1);
+        stepSequencerDisplay.setStep(i,
+            *audioProcessor.apvts.getRawParameterValue("seqValue" + stepNum) / 100.0f,
+            *audioProcessor.apvts.getRawParameterValue("seqGate" + stepNum) > 0.5f,
+            *audioProcessor.apvts.getRawParameterValue("seqGlide" + stepNum) > 0.5f);
+    }
+    stepSequencerDisplay.setPlayStep(audioProcessor.sequencerStep.load());
+
+    // Snapshot slots: playing, stored or empty; the selected slot has white text
+    const int activeSnapshot = audioProcessor.activeSnapshot.load();
+    const int selectedSnapshot = static_cast<int>(*audioProcessor.apvts.getRawParameterValue("snapshotSelect")) - 1;
+    for (int i = 0; i < DualCoreDSP::NUM_SNAPSHOTS; ++i)
+    {
+        auto& button = snapshotButtons[static_cast<size_t>(i)];
+        const auto colour = i == activeSnapshot ? juce::Colour(0xff00aaff)
+                          : audioProcessor.isSnapshotStored(i) ? juce::Colour(0xff3a3a5a)
+                                                               : juce::Colour(0xff1a1a30);
+        button.setColour(juce::TextButton::buttonColourId, colour);
+        button.setColour(juce::TextButton::textColourOffId,
+                         i == selectedSnapshot ? juce::Colours::white : juce::Colour(0xff8888aa));
+    }
 
     repaint();
 }
@@ -413,6 +749,27 @@ void DualCoreAudioProcessorEditor::paint(juce::Graphics& g)
     // Row 4: Output with meters and filter display
     drawSection(10, 550, 900, 120, "OUTPUT");
 
+    // Row 5: Input EQ
+    drawSection(10, 680, 900, 90, "INPUT EQ");
+
+    // Row 6: Stereo, Unison, MIDI
+    drawSection(10, 780, 300, 90, "STEREO");
+    drawSection(320, 780, 210, 90, "UNISON");
+    drawSection(540, 780, 160, 90, "MIDI");
+    drawSection(710, 780, 200, 90, "CROSS-MOD");
+
+    // Row 7: Multiband
+    drawSection(10, 880, 900, 90, "MULTIBAND");
+
+    // Row 8: Macros
+    drawSection(10, 980, 900, 90, "MACROS");
+
+    // Row 9: Step Sequencer
+    drawSection(10, 1080, 900, 110, "SEQUENCER");
+
+    // Row 10: Snapshots
+    drawSection(10, 1200, 900, 90, "SNAPSHOTS");
+
     // Draw meters
     float meterY = 580.0f * s;
     float meterH = 35.0f * s;
@@ -466,6 +823,9 @@ void DualCoreAudioProcessorEditor::resized()
     inputGainLabel.setBounds(x, row1Y, knob, labelH);
     inputGainSlider.setBounds(x, row1Y + labelH, knob, knob);
 
+    limiterCeilingLabel.setBounds(x + knob + static_cast<int>(5 * s), row1Y, smallKnob, labelH);
+    limiterCeilingSlider.setBounds(x + knob + static_cast<int>(5 * s), row1Y + labelH, smallKnob, smallKnob);
+
     int toggleY = row1Y + labelH + knob + margin;
     hiBoostButton.setBounds(x, toggleY, static_cast<int>(110 * s), buttonH);
     hiCutButton.setBounds(x, toggleY + buttonH + 4, static_cast<int>(110 * s), buttonH);
@@ -480,6 +840,10 @@ void DualCoreAudioProcessorEditor::resized()
     filter1ResoLabel.setBounds(x, row1Y, knob, labelH);
     filter1ResoSlider.setBounds(x, row1Y + labelH, knob, knob);
 
+    x += knob + static_cast<int>(5 * s);
+    filter1MorphLabel.setBounds(x, row1Y, smallKnob, labelH);
+    filter1MorphSlider.setBounds(x, row1Y + labelH, smallKnob, smallKnob);
+
     int filterComboY = row1Y + labelH + knob + margin;
     filter1ModeBox.setBounds(static_cast<int>(160 * s), filterComboY, static_cast<int>(80 * s), comboH);
     filter1TypeBox.setBounds(static_cast<int>(245 * s), filterComboY, static_cast<int>(85 * s), comboH);
@@ -493,13 +857,20 @@ void DualCoreAudioProcessorEditor::resized()
     filter2ResoLabel.setBounds(x, row1Y, knob, labelH);
     filter2ResoSlider.setBounds(x, row1Y + labelH, knob, knob);
 
+    x += knob + static_cast<int>(5 * s);
+    filter2MorphLabel.setBounds(x, row1Y, smallKnob, labelH);
+    filter2MorphSlider.setBounds(x, row1Y + labelH, smallKnob, smallKnob);
+
     filter2ModeBox.setBounds(static_cast<int>(360 * s), filterComboY, static_cast<int>(80 * s), comboH);
     filter2TypeBox.setBounds(static_cast<int>(445 * s), filterComboY, static_cast<int>(85 * s), comboH);
+    resoCompButton.setBounds(static_cast<int>(160 * s), filterComboY + comboH + 4, static_cast<int>(110 * s), buttonH);
 
     // FM section
     x = static_cast<int>(565 * s);
     fmAmountLabel.setBounds(x, row1Y, knob, labelH);
     fmAmountSlider.setBounds(x, row1Y + labelH, knob, knob);
+    expFreqModButton.setBounds(static_cast<int>(555 * s), filterComboY, static_cast<int>(70 * s), buttonH);
+    fmSourceBox.setBounds(static_cast<int>(555 * s), filterComboY + buttonH + 4, static_cast<int>(70 * s), comboH);
 
     // Drive section
     x = static_cast<int>(655 * s);
@@ -512,10 +883,21 @@ void DualCoreAudioProcessorEditor::resized()
 
     // Routing section
     x = static_cast<int>(760 * s);
-    routingButton.setBounds(x, row1Y, static_cast<int>(140 * s), buttonH);
-
-    mixLabel.setBounds(x + static_cast<int>(35 * s), row1Y + buttonH + margin, knob, labelH);
-    mixSlider.setBounds(x + static_cast<int>(35 * s), row1Y + buttonH + margin + labelH, knob, knob);
+    routingBox.setBounds(x, row1Y, static_cast<int>(140 * s), comboH);
+
+    int routingKnobY = row1Y + comboH + static_cast<int>(6 * s);
+    int routingLeftX = x + static_cast<int>(5 * s);
+    int routingRightX = x + static_cast<int>(75 * s);
+    mixLabel.setBounds(routingLeftX, routingKnobY, smallKnob, labelH);
+    mixSlider.setBounds(routingLeftX, routingKnobY + labelH, smallKnob, smallKnob);
+    routingBalanceLabel.setBounds(routingRightX, routingKnobY, smallKnob, labelH);
+    routingBalanceSlider.setBounds(routingRightX, routingKnobY + labelH, smallKnob, smallKnob);
+
+    routingKnobY += labelH + smallKnob + static_cast<int>(2 * s);
+    feedbackAmountLabel.setBounds(routingLeftX, routingKnobY, smallKnob, labelH);
+    feedbackAmountSlider.setBounds(routingLeftX, routingKnobY + labelH, smallKnob, smallKnob);
+    feedbackDelayLabel.setBounds(routingRightX, routingKnobY, smallKnob, labelH);
+    feedbackDelaySlider.setBounds(routingRightX, routingKnobY + labelH, smallKnob, smallKnob);
 
     // Row 2 Y position
     int row2Y = static_cast<int>(265 * s);
@@ -545,6 +927,12 @@ void DualCoreAudioProcessorEditor::resized()
     envSensLabel.setBounds(x, row2Y, smallKnob, labelH);
     envSensSlider.setBounds(x, row2Y + labelH, smallKnob, smallKnob);
 
+    int envRow2Y = row2Y + labelH + smallKnob + margin;
+    lookaheadLabel.setBounds(static_cast<int>(20 * s), envRow2Y, smallKnob, labelH);
+    lookaheadSlider.setBounds(static_cast<int>(20 * s), envRow2Y + labelH, smallKnob, smallKnob);
+    detectorSourceBox.setBounds(static_cast<int>(75 * s), envRow2Y + labelH, static_cast<int>(95 * s), comboH);
+    envTriggerBox.setBounds(static_cast<int>(180 * s), envRow2Y + labelH, static_cast<int>(80 * s), comboH);
+
     // LFO1 section
     x = static_cast<int>(355 * s);
     lfoRateLabel.setBounds(x, row2Y, smallKnob, labelH);
@@ -554,6 +942,10 @@ void DualCoreAudioProcessorEditor::resized()
     lfoDepthLabel.setBounds(x, row2Y, smallKnob, labelH);
     lfoDepthSlider.setBounds(x, row2Y + labelH, smallKnob, smallKnob);
 
+    x += smallKnob + margin;
+    lfoAudioRateLabel.setBounds(x, row2Y, smallKnob, labelH);
+    lfoAudioRateSlider.setBounds(x, row2Y + labelH, smallKnob, smallKnob);
+
     int comboY = row2Y + labelH + smallKnob + margin;
     lfoWaveBox.setBounds(static_cast<int>(355 * s), comboY, static_cast<int>(75 * s), comboH);
     lfoTargetBox.setBounds(static_cast<int>(435 * s), comboY, static_cast<int>(60 * s), comboH);
@@ -571,6 +963,10 @@ void DualCoreAudioProcessorEditor::resized()
     lfo2DepthLabel.setBounds(x, row2Y, smallKnob, labelH);
     lfo2DepthSlider.setBounds(x, row2Y + labelH, smallKnob, smallKnob);
 
+    x += smallKnob + margin;
+    lfo2AudioRateLabel.setBounds(x, row2Y, smallKnob, labelH);
+    lfo2AudioRateSlider.setBounds(x, row2Y + labelH, smallKnob, smallKnob);
+
     lfo2WaveBox.setBounds(static_cast<int>(540 * s), comboY, static_cast<int>(140 * s), comboH);
 
     lfo2SyncButton.setBounds(static_cast<int>(540 * s), syncY, static_cast<int>(55 * s), buttonH);
@@ -612,9 +1008,200 @@ void DualCoreAudioProcessorEditor::resized()
         slot.amountSlider.setBounds(slotX + srcComboW + dstComboW + 10, slotY, amtSliderW, comboH);
     }
 
-    // Row 4: Output section - filter response display
+    // Row 4: Output section - output limiter and surround options below the meters, filter response display
+    outputLimiterButton.setBounds(static_cast<int>(30 * s), static_cast<int>(638 * s), static_cast<int>(110 * s), buttonH);
+    excludeCentreLFEButton.setBounds(static_cast<int>(230 * s), static_cast<int>(638 * s), static_cast<int>(130 * s), buttonH);
+    auxModeBox.setBounds(static_cast<int>(143 * s), static_cast<int>(638 * s), static_cast<int>(84 * s), comboH);
+
     filterResponseDisplay.setBounds(static_cast<int>(430 * s), static_cast<int>(565 * s),
                                     static_cast<int>(470 * s), static_cast<int>(90 * s));
+
+    // Row 5: Input EQ - one F/G/Q knob group per band
+    int row5Y = static_cast<int>(700 * s);
+    int eqKnobSpacing = static_cast<int>(50 * s);
+
+    for (int i = 0; i < 4; ++i)
+    {
+        int bandX = static_cast<int>((30 + i * 225) * s);
+        auto& band = eqBandUIs[i];
+
+        band.freqLabel.setBounds(bandX, row5Y, smallKnob, labelH);
+        band.freqSlider.setBounds(bandX, row5Y + labelH, smallKnob, smallKnob);
+        band.gainLabel.setBounds(bandX + eqKnobSpacing, row5Y, smallKnob, labelH);
+        band.gainSlider.setBounds(bandX + eqKnobSpacing, row5Y + labelH, smallKnob, smallKnob);
+        band.qLabel.setBounds(bandX + eqKnobSpacing * 2, row5Y, smallKnob, labelH);
+        band.qSlider.setBounds(bandX + eqKnobSpacing * 2, row5Y + labelH, smallKnob, smallKnob);
+    }
+
+    // Row 6: Stereo - M/S and link toggles, side offsets, spread and drift
+    int row6Y = static_cast<int>(800 * s);
+    midSideButton.setBounds(static_cast<int>(20 * s), row6Y + labelH / 2, static_cast<int>(70 * s), buttonH);
+    sideLinkButton.setBounds(static_cast<int>(20 * s), row6Y + labelH / 2 + buttonH + 4, static_cast<int>(70 * s), buttonH);
+
+    x = static_cast<int>(100 * s);
+    sideFreqOffsetLabel.setBounds(x, row6Y, smallKnob + 10, labelH);
+    sideFreqOffsetSlider.setBounds(x, row6Y + labelH, smallKnob, smallKnob);
+    x += static_cast<int>(52 * s);
+    sideResoOffsetLabel.setBounds(x, row6Y, smallKnob + 10, labelH);
+    sideResoOffsetSlider.setBounds(x, row6Y + labelH, smallKnob, smallKnob);
+    x += static_cast<int>(52 * s);
+    stereoSpreadLabel.setBounds(x, row6Y, smallKnob + 10, labelH);
+    stereoSpreadSlider.setBounds(x, row6Y + labelH, smallKnob, smallKnob);
+    x += static_cast<int>(52 * s);
+    driftLabel.setBounds(x, row6Y, smallKnob + 10, labelH);
+    driftSlider.setBounds(x, row6Y + labelH, smallKnob, smallKnob);
+
+    // Row 6: Unison - voice count, detune and resonance spread
+    x = static_cast<int>(340 * s);
+    unisonVoicesLabel.setBounds(x, row6Y, smallKnob + 10, labelH);
+    unisonVoicesSlider.setBounds(x, row6Y + labelH, smallKnob, smallKnob);
+    x += static_cast<int>(65 * s);
+    unisonDetuneLabel.setBounds(x, row6Y, smallKnob + 10, labelH);
+    unisonDetuneSlider.setBounds(x, row6Y + labelH, smallKnob, smallKnob);
+    x += static_cast<int>(65 * s);
+    unisonResoSpreadLabel.setBounds(x, row6Y, smallKnob + 10, labelH);
+    unisonResoSpreadSlider.setBounds(x, row6Y + labelH, smallKnob, smallKnob);
+
+    // Row 6: MIDI - poly mode and LFO retrigger toggles, key tracking
+    polyModeButton.setBounds(static_cast<int>(555 * s), row6Y + labelH / 2, static_cast<int>(70 * s), buttonH);
+    lfoRetriggerButton.setBounds(static_cast<int>(555 * s), row6Y + labelH / 2 + buttonH + 4, static_cast<int>(70 * s), buttonH);
+    x = static_cast<int>(635 * s);
+    keyTrackLabel.setBounds(x, row6Y, smallKnob + 10, labelH);
+    keyTrackSlider.setBounds(x, row6Y + labelH, smallKnob, smallKnob);
+
+    // Row 6: Cross-mod - F2 -> F1 and self FM depths, each with its own EXP toggle
+    x = static_cast<int>(720 * s);
+    fmReturnLabel.setBounds(x, row6Y, smallKnob + 10, labelH);
+    fmReturnSlider.setBounds(x, row6Y + labelH, smallKnob, smallKnob);
+    x += static_cast<int>(50 * s);
+    selfFMLabel.setBounds(x, row6Y, smallKnob + 10, labelH);
+    selfFMSlider.setBounds(x, row6Y + labelH, smallKnob, smallKnob);
+    fmReturnExpButton.setBounds(static_cast<int>(820 * s), row6Y + labelH / 2, static_cast<int>(85 * s), buttonH);
+    selfFMExpButton.setBounds(static_cast<int>(820 * s), row6Y + labelH / 2 + buttonH + 4, static_cast<int>(85 * s), buttonH);
+
+    // Row 7: Multiband - band count and crossovers, then an FRQ/DRV/MIX group per band
+    int row7Y = static_cast<int>(900 * s);
+    int bandKnobSpacing = static_cast<int>(50 * s);
+    bandCountBox.setBounds(static_cast<int>(20 * s), row7Y + labelH, static_cast<int>(80 * s), comboH);
+
+    for (int i = 0; i < 3; ++i)
+    {
+        x = static_cast<int>(110 * s) + i * bandKnobSpacing;
+        crossoverLabels[i].setBounds(x, row7Y, smallKnob, labelH);
+        crossoverSliders[i].setBounds(x, row7Y + labelH, smallKnob, smallKnob);
+    }
+
+    for (int i = 0; i < 4; ++i)
+    {
+        int bandX = static_cast<int>((275 + i * 157) * s);
+        auto& band = bandUIs[i];
+
+        band.offsetLabel.setBounds(bandX, row7Y, smallKnob, labelH);
+        band.offsetSlider.setBounds(bandX, row7Y + labelH, smallKnob, smallKnob);
+        band.driveLabel.setBounds(bandX + bandKnobSpacing, row7Y, smallKnob, labelH);
+        band.driveSlider.setBounds(bandX + bandKnobSpacing, row7Y + labelH, smallKnob, smallKnob);
+        band.mixLabel.setBounds(bandX + bandKnobSpacing * 2, row7Y, smallKnob, labelH);
+        band.mixSlider.setBounds(bandX + bandKnobSpacing * 2, row7Y + labelH, smallKnob, smallKnob);
+    }
+
+    // Row 8: Macros - eight knobs, then the editor for the selected macro target
+    int row8Y = static_cast<int>(1000 * s);
+    for (int i = 0; i < 8; ++i)
+    {
+        x = static_cast<int>(20 * s) + i * bandKnobSpacing;
+        macroLabels[i].setBounds(x, row8Y, smallKnob, labelH);
+        macroSliders[i].setBounds(x, row8Y + labelH, smallKnob, smallKnob);
+    }
+
+    macroTargetBox.setBounds(static_cast<int>(480 * s), row8Y + labelH, static_cast<int>(60 * s), comboH);
+    macroSourceBox.setBounds(static_cast<int>(545 * s), row8Y + labelH, static_cast<int>(70 * s), comboH);
+    macroDestBox.setBounds(static_cast<int>(620 * s), row8Y + labelH, static_cast<int>(90 * s), comboH);
+
+    x = static_cast<int>(720 * s);
+    macroMinLabel.setBounds(x, row8Y, smallKnob, labelH);
+    macroMinSlider.setBounds(x, row8Y + labelH, smallKnob, smallKnob);
+    x += bandKnobSpacing;
+    macroMaxLabel.setBounds(x, row8Y, smallKnob, labelH);
+    macroMaxSlider.setBounds(x, row8Y + labelH, smallKnob, smallKnob);
+    x += bandKnobSpacing;
+    macroCurveLabel.setBounds(x, row8Y, smallKnob + 10, labelH);
+    macroCurveSlider.setBounds(x, row8Y + labelH, smallKnob, smallKnob);
+
+    // Row 9: Step Sequencer - steps, gate length and rate, then the step editor
+    int row9Y = static_cast<int>(1100 * s);
+    x = static_cast<int>(20 * s);
+    seqLengthLabel.setBounds(x, row9Y, smallKnob, labelH);
+    seqLengthSlider.setBounds(x, row9Y + labelH, smallKnob, smallKnob);
+    x += bandKnobSpacing;
+    seqGateLengthLabel.setBounds(x, row9Y, smallKnob, labelH);
+    seqGateLengthSlider.setBounds(x, row9Y + labelH, smallKnob, smallKnob);
+    seqRateBox.setBounds(static_cast<int>(125 * s), row9Y + labelH, static_cast<int>(70 * s), comboH);
+    stepSequencerDisplay.setBounds(static_cast<int>(205 * s), row9Y - static_cast<int>(2 * s),
+                                   static_cast<int>(695 * s), static_cast<int>(85 * s));
+
+    // Row 10: Snapshots - mode, the eight slots with STORE / CLEAR, then count, rate and fade
+    int row10Y = static_cast<int>(1220 * s);
+    snapshotModeBox.setBounds(static_cast<int>(20 * s), row10Y + labelH, static_cast<int>(80 * s), comboH);
+    for (int i = 0; i < DualCoreDSP::NUM_SNAPSHOTS; ++i)
+        snapshotButtons[static_cast<size_t>(i)].setBounds(static_cast<int>((110 + i * 44) * s), row10Y + labelH,
+                                                          static_cast<int>(40 * s), comboH);
+    snapshotStoreButton.setBounds(static_cast<int>(470 * s), row10Y + labelH, static_cast<int>(60 * s), comboH);
+    snapshotClearButton.setBounds(static_cast<int>(535 * s), row10Y + labelH, static_cast<int>(60 * s), comboH);
+
+    x = static_cast<int>(620 * s);
+    snapshotCountLabel.setBounds(x, row10Y, smallKnob, labelH);
+    snapshotCountSlider.setBounds(x, row10Y + labelH, smallKnob, smallKnob);
+    snapshotRateBox.setBounds(x + bandKnobSpacing, row10Y + labelH, static_cast<int>(70 * s), comboH);
+    x += bandKnobSpacing + static_cast<int>(80 * s);
+    snapshotFadeLabel.setBounds(x, row10Y, smallKnob, labelH);
+    snapshotFadeSlider.setBounds(x, row10Y + labelH, smallKnob, smallKnob);
+}
+
+void DualCoreAudioProcessorEditor::snapshotButtonClicked(int index)
+{
+    if (snapshotStoreButton.getToggleState())
+        audioProcessor.storeSnapshot(index);
+    else if (snapshotClearButton.getToggleState())
+        audioProcessor.clearSnapshot(index);
+    else
+        setParameterFromUI("snapshotSelect", static_cast<float>(index + 1));
+
+    // Arming is one-shot so a stray click can't overwrite another slot
+    snapshotStoreButton.setToggleState(false, juce::dontSendNotification);
+    snapshotClearButton.setToggleState(false, juce::dontSendNotification);
+}
+
+void DualCoreAudioProcessorEditor::showMacroTarget(int targetIndex)
+{
+    // Detach first so the old target's parameters aren't written while the controls update
+    macroSourceAttachment.reset();
+    macroDestAttachment.reset();
+    macroMinAttachment.reset();
+    macroMaxAttachment.reset();
+    macroCurveAttachment.reset();
+
+    const juce::String targetNum(targetIndex + 1);
+    macroSourceAttachment = std::make_unique<juce::AudioProcessorValueTreeState::ComboBoxAttachment>(
+        audioProcessor.apvts, "macroSource" + targetNum, macroSourceBox);
+    macroDestAttachment = std::make_unique<juce::AudioProcessorValueTreeState::ComboBoxAttachment>(
+        audioProcessor.apvts, "macroDest" + targetNum, macroDestBox);
+    macroMinAttachment = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(
+        audioProcessor.apvts, "macroMin" + targetNum, macroMinSlider);
+    macroMaxAttachment = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(
+        audioProcessor.apvts, "macroMax" + targetNum, macroMaxSlider);
+    macroCurveAttachment = std::make_unique<juce::AudioProcessorValueTreeState::SliderAttachment>(
+        audioProcessor.apvts, "macroCurve" + targetNum, macroCurveSlider);
+}
+
+void DualCoreAudioProcessorEditor::setParameterFromUI(const juce::String& paramID, float value)
+{
+    // Edits from custom components are single-step gestures, so hosts can record them
+    if (auto* param = audioProcessor.apvts.getParameter(paramID))
+    {
+        param->beginChangeGesture();
+        param->setValueNotifyingHost(param->convertTo0to1(value));
+        param->endChangeGesture();
+    }
 }
 
 void DualCoreAudioProcessorEditor::refreshPresetList()
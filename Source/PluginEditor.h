@@ -5,6 +5,7 @@
 #include "PluginProcessor.h"
 #include "CustomLookAndFeel.h"
 #include "FilterResponseDisplay.h"
+#include "StepSequencerDisplay.h"
 
 class DualCoreAudioProcessorEditor : public juce::AudioProcessorEditor,
                                       private juce::Timer
@@ -27,7 +28,7 @@ private:
 
     // Base dimensions
     static constexpr int BASE_WIDTH = 920;
-    static constexpr int BASE_HEIGHT = 780;
+    static constexpr int BASE_HEIGHT = 1300;
     float currentScale = 1.0f;
 
     // === Input Section ===
@@ -36,6 +37,11 @@ private:
     juce::ToggleButton hiBoostButton;
     juce::ToggleButton hiCutButton;
     juce::ToggleButton limiterButton;
+    juce::Slider limiterCeilingSlider;
+    juce::Label limiterCeilingLabel;
+    juce::ToggleButton outputLimiterButton;
+    juce::ToggleButton excludeCentreLFEButton;
+    juce::ComboBox auxModeBox;
 
     // === Filter 1 ===
     juce::Slider filter1FreqSlider;
@@ -44,6 +50,8 @@ private:
     juce::ComboBox filter1TypeBox;
     juce::Label filter1FreqLabel;
     juce::Label filter1ResoLabel;
+    juce::Slider filter1MorphSlider;
+    juce::Label filter1MorphLabel;
 
     // === Filter 2 ===
     juce::Slider filter2FreqSlider;
@@ -52,10 +60,15 @@ private:
     juce::ComboBox filter2TypeBox;
     juce::Label filter2FreqLabel;
     juce::Label filter2ResoLabel;
+    juce::Slider filter2MorphSlider;
+    juce::Label filter2MorphLabel;
+    juce::ToggleButton resoCompButton;
 
     // === FM ===
     juce::Slider fmAmountSlider;
     juce::Label fmAmountLabel;
+    juce::ToggleButton expFreqModButton;
+    juce::ComboBox fmSourceBox;
 
     // === ADSR Envelope ===
     juce::Slider envAttackSlider;
@@ -70,6 +83,10 @@ private:
     juce::Label envReleaseLabel;
     juce::Label envAmountLabel;
     juce::Label envSensLabel;
+    juce::Slider lookaheadSlider;
+    juce::Label lookaheadLabel;
+    juce::ComboBox detectorSourceBox;
+    juce::ComboBox envTriggerBox;
 
     // === LFO1 ===
     juce::Slider lfoRateSlider;
@@ -80,6 +97,8 @@ private:
     juce::Label lfoDepthLabel;
     juce::ToggleButton lfoSyncButton;
     juce::ComboBox lfoDivBox;
+    juce::Slider lfoAudioRateSlider;
+    juce::Label lfoAudioRateLabel;
 
     // === LFO2 ===
     juce::Slider lfo2RateSlider;
@@ -89,6 +108,8 @@ private:
     juce::Label lfo2DepthLabel;
     juce::ToggleButton lfo2SyncButton;
     juce::ComboBox lfo2DivBox;
+    juce::Slider lfo2AudioRateSlider;
+    juce::Label lfo2AudioRateLabel;
 
     // === Modulation Matrix ===
     struct ModSlotUI
@@ -99,6 +120,18 @@ private:
     };
     std::array<ModSlotUI, 6> modSlotUIs;
 
+    // === Input EQ ===
+    struct EQBandUI
+    {
+        juce::Slider freqSlider;
+        juce::Slider gainSlider;
+        juce::Slider qSlider;
+        juce::Label freqLabel;
+        juce::Label gainLabel;
+        juce::Label qLabel;
+    };
+    std::array<EQBandUI, 4> eqBandUIs;
+
     // === AM ===
     juce::Slider amAmountSlider;
     juce::Slider amAttackSlider;
@@ -114,9 +147,99 @@ private:
     juce::ToggleButton drivePrePostButton;
 
     // === Routing ===
-    juce::ToggleButton routingButton;
+    juce::ComboBox routingBox;
     juce::Slider mixSlider;
     juce::Label mixLabel;
+    juce::Slider routingBalanceSlider;
+    juce::Label routingBalanceLabel;
+    juce::Slider feedbackAmountSlider;
+    juce::Label feedbackAmountLabel;
+    juce::Slider feedbackDelaySlider;
+    juce::Label feedbackDelayLabel;
+
+    // === Stereo ===
+    juce::ToggleButton midSideButton;
+    juce::ToggleButton sideLinkButton;
+    juce::Slider sideFreqOffsetSlider;
+    juce::Slider sideResoOffsetSlider;
+    juce::Slider stereoSpreadSlider;
+    juce::Label sideFreqOffsetLabel;
+    juce::Label sideResoOffsetLabel;
+    juce::Label stereoSpreadLabel;
+    juce::Slider driftSlider;
+    juce::Label driftLabel;
+
+    // === Unison ===
+    juce::Slider unisonVoicesSlider;
+    juce::Slider unisonDetuneSlider;
+    juce::Slider unisonResoSpreadSlider;
+    juce::Label unisonVoicesLabel;
+    juce::Label unisonDetuneLabel;
+    juce::Label unisonResoSpreadLabel;
+
+    // === Poly ===
+    juce::ToggleButton polyModeButton;
+    juce::ToggleButton lfoRetriggerButton;
+    juce::Slider keyTrackSlider;
+    juce::Label keyTrackLabel;
+
+    // === Cross-Mod ===
+    juce::Slider fmReturnSlider;
+    juce::Label fmReturnLabel;
+    juce::Slider selfFMSlider;
+    juce::Label selfFMLabel;
+    juce::ToggleButton fmReturnExpButton;
+    juce::ToggleButton selfFMExpButton;
+
+    // === Multiband ===
+    juce::ComboBox bandCountBox;
+    std::array<juce::Slider, 3> crossoverSliders;
+    std::array<juce::Label, 3> crossoverLabels;
+
+    struct BandUI
+    {
+        juce::Slider offsetSlider;
+        juce::Slider driveSlider;
+        juce::Slider mixSlider;
+        juce::Label offsetLabel;
+        juce::Label driveLabel;
+        juce::Label mixLabel;
+    };
+    std::array<BandUI, 4> bandUIs;
+
+    // === Macros ===
+    std::array<juce::Slider, 8> macroSliders;
+    std::array<juce::Label, 8> macroLabels;
+    juce::ComboBox macroTargetBox;  // Which of the 16 targets the controls below edit
+    juce::ComboBox macroSourceBox;
+    juce::ComboBox macroDestBox;
+    juce::Slider macroMinSlider;
+    juce::Slider macroMaxSlider;
+    juce::Slider macroCurveSlider;
+    juce::Label macroMinLabel;
+    juce::Label macroMaxLabel;
+    juce::Label macroCurveLabel;
+
+    // === Step Sequencer ===
+    juce::Slider seqLengthSlider;
+    juce::Slider seqGateLengthSlider;
+    juce::Label seqLengthLabel;
+    juce::Label seqGateLengthLabel;
+    juce::ComboBox seqRateBox;
+    StepSequencerDisplay stepSequencerDisplay;
+
+    // === Snapshots ===
+    // A slot button selects the slot, or stores into / clears it while STORE / CLEAR is armed
+    juce::ComboBox snapshotModeBox;
+    std::array<juce::TextButton, DualCoreDSP::NUM_SNAPSHOTS> snapshotButtons;
+    juce::TextButton snapshotStoreButton;
+    juce::TextButton snapshotClearButton;
+    juce::Slider snapshotCountSlider;
+    juce::Slider snapshotFadeSlider;
+    juce::Label snapshotCountLabel;
+    juce::Label snapshotFadeLabel;
+    juce::ComboBox snapshotRateBox;
+    void snapshotButtonClicked(int index);
 
     // === Filter Response Display ===
     FilterResponseDisplay filterResponseDisplay;
@@ -132,18 +255,27 @@ private:
     std::unique_ptr<juce::AudioProcessorValueTreeState::ButtonAttachment> hiBoostAttachment;
     std::unique_ptr<juce::AudioProcessorValueTreeState::ButtonAttachment> hiCutAttachment;
     std::unique_ptr<juce::AudioProcessorValueTreeState::ButtonAttachment> limiterAttachment;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> limiterCeilingAttachment;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::ButtonAttachment> outputLimiterAttachment;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::ButtonAttachment> excludeCentreLFEAttachment;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::ComboBoxAttachment> auxModeAttachment;
 
     std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> filter1FreqAttachment;
     std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> filter1ResoAttachment;
     std::unique_ptr<juce::AudioProcessorValueTreeState::ComboBoxAttachment> filter1ModeAttachment;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> filter1MorphAttachment;
     std::unique_ptr<juce::AudioProcessorValueTreeState::ComboBoxAttachment> filter1TypeAttachment;
 
     std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> filter2FreqAttachment;
     std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> filter2ResoAttachment;
     std::unique_ptr<juce::AudioProcessorValueTreeState::ComboBoxAttachment> filter2ModeAttachment;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> filter2MorphAttachment;
     std::unique_ptr<juce::AudioProcessorValueTreeState::ComboBoxAttachment> filter2TypeAttachment;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::ButtonAttachment> resoCompAttachment;
 
     std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> fmAmountAttachment;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::ButtonAttachment> expFreqModAttachment;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::ComboBoxAttachment> fmSourceAttachment;
 
     std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> envAttackAttachment;
     std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> envDecayAttachment;
@@ -151,6 +283,9 @@ private:
     std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> envReleaseAttachment;
     std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> envAmountAttachment;
     std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> envSensAttachment;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> lookaheadAttachment;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::ComboBoxAttachment> detectorSourceAttachment;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::ComboBoxAttachment> envTriggerAttachment;
 
     std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> lfoRateAttachment;
     std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> lfoDepthAttachment;
@@ -158,12 +293,14 @@ private:
     std::unique_ptr<juce::AudioProcessorValueTreeState::ComboBoxAttachment> lfoTargetAttachment;
     std::unique_ptr<juce::AudioProcessorValueTreeState::ButtonAttachment> lfoSyncAttachment;
     std::unique_ptr<juce::AudioProcessorValueTreeState::ComboBoxAttachment> lfoDivAttachment;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> lfoAudioRateAttachment;
 
     std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> lfo2RateAttachment;
     std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> lfo2DepthAttachment;
     std::unique_ptr<juce::AudioProcessorValueTreeState::ComboBoxAttachment> lfo2WaveAttachment;
     std::unique_ptr<juce::AudioProcessorValueTreeState::ButtonAttachment> lfo2SyncAttachment;
     std::unique_ptr<juce::AudioProcessorValueTreeState::ComboBoxAttachment> lfo2DivAttachment;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> lfo2AudioRateAttachment;
 
     // Modulation Matrix Attachments
     struct ModSlotAttachments
@@ -174,6 +311,15 @@ private:
     };
     std::array<ModSlotAttachments, 6> modSlotAttachments;
 
+    // Input EQ Attachments
+    struct EQBandAttachments
+    {
+        std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> freqAttachment;
+        std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> gainAttachment;
+        std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> qAttachment;
+    };
+    std::array<EQBandAttachments, 4> eqBandAttachments;
+
     std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> amAmountAttachment;
     std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> amAttackAttachment;
     std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> amReleaseAttachment;
@@ -182,8 +328,62 @@ private:
     std::unique_ptr<juce::AudioProcessorValueTreeState::ComboBoxAttachment> driveTypeAttachment;
     std::unique_ptr<juce::AudioProcessorValueTreeState::ButtonAttachment> drivePrePostAttachment;
 
-    std::unique_ptr<juce::AudioProcessorValueTreeState::ButtonAttachment> routingAttachment;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::ComboBoxAttachment> routingAttachment;
     std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> mixAttachment;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> routingBalanceAttachment;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> feedbackAmountAttachment;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> feedbackDelayAttachment;
+
+    std::unique_ptr<juce::AudioProcessorValueTreeState::ButtonAttachment> midSideAttachment;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::ButtonAttachment> sideLinkAttachment;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sideFreqOffsetAttachment;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> sideResoOffsetAttachment;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> stereoSpreadAttachment;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> driftAttachment;
+
+    std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> unisonVoicesAttachment;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> unisonDetuneAttachment;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> unisonResoSpreadAttachment;
+
+    std::unique_ptr<juce::AudioProcessorValueTreeState::ButtonAttachment> polyModeAttachment;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::ButtonAttachment> lfoRetriggerAttachment;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> keyTrackAttachment;
+
+    std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> fmReturnAttachment;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> selfFMAttachment;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::ButtonAttachment> fmReturnExpAttachment;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::ButtonAttachment> selfFMExpAttachment;
+
+    // Multiband Attachments
+    std::unique_ptr<juce::AudioProcessorValueTreeState::ComboBoxAttachment> bandCountAttachment;
+    std::array<std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment>, 3> crossoverAttachments;
+
+    struct BandAttachments
+    {
+        std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> offsetAttachment;
+        std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> driveAttachment;
+        std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> mixAttachment;
+    };
+    std::array<BandAttachments, 4> bandAttachments;
+
+    // Macro Attachments (the target ones are re-created when another target is selected)
+    std::array<std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment>, 8> macroAttachments;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::ComboBoxAttachment> macroSourceAttachment;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::ComboBoxAttachment> macroDestAttachment;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> macroMinAttachment;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> macroMaxAttachment;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> macroCurveAttachment;
+
+    // Step Sequencer Attachments (steps are edited through the display)
+    std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> seqLengthAttachment;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> seqGateLengthAttachment;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::ComboBoxAttachment> seqRateAttachment;
+
+    // Snapshot Attachments (the selected slot is set through the slot buttons)
+    std::unique_ptr<juce::AudioProcessorValueTreeState::ComboBoxAttachment> snapshotModeAttachment;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> snapshotCountAttachment;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::ComboBoxAttachment> snapshotRateAttachment;
+    std::unique_ptr<juce::AudioProcessorValueTreeState::SliderAttachment> snapshotFadeAttachment;
 
     // Level meters
     float inputLevelL = 0.0f;
@@ -192,6 +392,8 @@ private:
     float outputLevelR = 0.0f;
 
     void refreshPresetList();
+    void showMacroTarget(int targetIndex);
+    void setParameterFromUI(const juce::String& paramID, float value);
     void savePresetDialog();
     void loadSelectedPreset();
 
@@ -5,9 +5,38 @@
 DualCoreAudioProcessor::DualCoreAudioProcessor()
     : AudioProcessor(BusesProperties()
                      .withInput("Input", juce::AudioChannelSet::stereo(), true)
-                     .withOutput("Output", juce::AudioChannelSet::stereo(), true)),
+                     .withOutput("Output", juce::AudioChannelSet::stereo(), true)
+                     .withInput("Sidechain", juce::AudioChannelSet::stereo(), false)
+                     .withOutput("Aux 1", juce::AudioChannelSet::stereo(), false)
+                     .withOutput("Aux 2", juce::AudioChannelSet::stereo(), false)
+                     .withOutput("Aux 3", juce::AudioChannelSet::stereo(), false)),
       apvts(*this, nullptr, "Parameters", createParameterLayout())
 {
+    for (int i = 0; i < DualCoreDSP::NUM_MACROS; ++i)
+        macroParameters[static_cast<size_t>(i)] = apvts.getRawParameterValue("macro" + juce::String(i + 1));
+
+    for (int i = 0; i < DualCoreDSP::NUM_MACRO_TARGETS; ++i)
+    {
+        const juce::String targetNum(i + 1);
+        auto& target = macroTargetParameters[static_cast<size_t>(i)];
+        target.source = apvts.getRawParameterValue("macroSource" + targetNum);
+        target.destination = apvts.getRawParameterValue("macroDest" + targetNum);
+        target.rangeMin = apvts.getRawParameterValue("macroMin" + targetNum);
+        target.rangeMax = apvts.getRawParameterValue("macroMax" + targetNum);
+        target.curve = apvts.getRawParameterValue("macroCurve" + targetNum);
+    }
+
+    for (int i = 0; i < DualCoreDSP::MAX_SEQ_STEPS; ++i)
+    {
+        const juce::String stepNum(i + 1);
+        auto& step = sequencerStepParameters[static_cast<size_t>(i)];
+        step.value = apvts.getRawParameterValue("seqValue" + stepNum);
+        step.gate = apvts.getRawParameterValue("seqGate" + stepNum);
+        step.glide = apvts.getRawParameterValue("seqGlide" + stepNum);
+    }
+
+    driftSeed.store(static_cast<uint32_t>(juce::Random::getSystemRandom().nextInt()));
+
     installFactoryPresets();
 }
 
@@ -45,6 +74,70 @@ juce::AudioProcessorValueTreeState::ParameterLayout DualCoreAudioProcessor::crea
         "Limiter",
         false));
 
+    params.push_back(std::make_unique<juce::AudioParameterBool>(
+        juce::ParameterID{OUTPUT_LIMITER_ID, 1},
+        "Output Limiter",
+        false));
+
+    params.push_back(std::make_unique<juce::AudioParameterFloat>(
+        juce::ParameterID{LIMITER_CEILING_ID, 1},
+        "Limiter Ceiling",
+        juce::NormalisableRange<float>(-12.0f, 0.0f, 0.1f),
+        -1.0f,
+        juce::String(),
+        juce::AudioProcessorParameter::genericParameter,
+        [](float value, int) { return juce::String(value, 1) + " dBTP"; },
+        nullptr));
+
+    // Surround layouts: pass centre and LFE through untouched
+    params.push_back(std::make_unique<juce::AudioParameterBool>(
+        juce::ParameterID{EXCLUDE_CENTRE_LFE_ID, 1},
+        "Exclude Centre/LFE",
+        false));
+
+    // What the Aux 1/2/3 output buses carry
+    params.push_back(std::make_unique<juce::AudioParameterChoice>(
+        juce::ParameterID{AUX_MODE_ID, 1},
+        "Aux Outputs",
+        juce::StringArray{"F1 / F2 / Dry", "F1 LP / BP / HP", "F2 LP / BP / HP"},
+        0));
+
+    // === Input EQ ===
+    auto addEQBand = [&params](const char* freqID, const char* gainID, const char* qID, const juce::String& name,
+                               float minFreq, float maxFreq, float defaultFreq, float maxQ, float defaultQ)
+    {
+        params.push_back(std::make_unique<juce::AudioParameterFloat>(
+            juce::ParameterID{freqID, 1},
+            "EQ " + name + " Frequency",
+            juce::NormalisableRange<float>(minFreq, maxFreq, 0.1f, 0.3f),
+            defaultFreq,
+            juce::String(),
+            juce::AudioProcessorParameter::genericParameter,
+            [](float value, int) { return juce::String(value, 0) + " Hz"; },
+            nullptr));
+
+        params.push_back(std::make_unique<juce::AudioParameterFloat>(
+            juce::ParameterID{gainID, 1},
+            "EQ " + name + " Gain",
+            juce::NormalisableRange<float>(-18.0f, 18.0f, 0.1f),
+            0.0f,
+            juce::String(),
+            juce::AudioProcessorParameter::genericParameter,
+            [](float value, int) { return juce::String(value, 1) + " dB"; },
+            nullptr));
+
+        params.push_back(std::make_unique<juce::AudioParameterFloat>(
+            juce::ParameterID{qID, 1},
+            "EQ " + name + " Q",
+            juce::NormalisableRange<float>(0.3f, maxQ, 0.01f, 0.5f),
+            defaultQ));
+    };
+
+    addEQBand(EQ_LOW_FREQ_ID, EQ_LOW_GAIN_ID, EQ_LOW_Q_ID, "Low", 20.0f, 1000.0f, 100.0f, 2.0f, 0.707f);
+    addEQBand(EQ_MID1_FREQ_ID, EQ_MID1_GAIN_ID, EQ_MID1_Q_ID, "Mid 1", 100.0f, 8000.0f, 500.0f, 10.0f, 1.0f);
+    addEQBand(EQ_MID2_FREQ_ID, EQ_MID2_GAIN_ID, EQ_MID2_Q_ID, "Mid 2", 300.0f, 16000.0f, 2500.0f, 10.0f, 1.0f);
+    addEQBand(EQ_HIGH_FREQ_ID, EQ_HIGH_GAIN_ID, EQ_HIGH_Q_ID, "High", 1000.0f, 20000.0f, 8000.0f, 2.0f, 0.707f);
+
     // === Filter 1 ===
     params.push_back(std::make_unique<juce::AudioParameterFloat>(
         juce::ParameterID{FILTER1_FREQ_ID, 1},
@@ -65,7 +158,7 @@ juce::AudioProcessorValueTreeState::ParameterLayout DualCoreAudioProcessor::crea
     params.push_back(std::make_unique<juce::AudioParameterChoice>(
         juce::ParameterID{FILTER1_MODE_ID, 1},
         "Filter 1 Mode",
-        juce::StringArray{"Low Pass", "High Pass", "Band Pass", "Notch"},
+        juce::StringArray{"Low Pass", "High Pass", "Band Pass", "Notch", "Morph"},
         0));
 
     params.push_back(std::make_unique<juce::AudioParameterChoice>(
@@ -74,6 +167,12 @@ juce::AudioProcessorValueTreeState::ParameterLayout DualCoreAudioProcessor::crea
         juce::StringArray{"SVF", "Ladder", "Diode", "MS-20", "Steiner", "OTA"},
         0));
 
+    params.push_back(std::make_unique<juce::AudioParameterFloat>(
+        juce::ParameterID{FILTER1_MORPH_ID, 1},
+        "Filter 1 Morph",
+        juce::NormalisableRange<float>(0.0f, 1.0f, 0.01f),
+        0.0f));
+
     // === Filter 2 ===
     params.push_back(std::make_unique<juce::AudioParameterFloat>(
         juce::ParameterID{FILTER2_FREQ_ID, 1},
@@ -94,7 +193,7 @@ juce::AudioProcessorValueTreeState::ParameterLayout DualCoreAudioProcessor::crea
     params.push_back(std::make_unique<juce::AudioParameterChoice>(
         juce::ParameterID{FILTER2_MODE_ID, 1},
         "Filter 2 Mode",
-        juce::StringArray{"Low Pass", "High Pass", "Band Pass", "Notch"},
+        juce::StringArray{"Low Pass", "High Pass", "Band Pass", "Notch", "Morph"},
         0));
 
     params.push_back(std::make_unique<juce::AudioParameterChoice>(
@@ -103,6 +202,18 @@ juce::AudioProcessorValueTreeState::ParameterLayout DualCoreAudioProcessor::crea
         juce::StringArray{"SVF", "Ladder", "Diode", "MS-20", "Steiner", "OTA"},
         0));
 
+    params.push_back(std::make_unique<juce::AudioParameterFloat>(
+        juce::ParameterID{FILTER2_MORPH_ID, 1},
+        "Filter 2 Morph",
+        juce::NormalisableRange<float>(0.0f, 1.0f, 0.01f),
+        0.0f));
+
+    // Level make-up for resonance, per filter type (off keeps older presets unchanged)
+    params.push_back(std::make_unique<juce::AudioParameterBool>(
+        juce::ParameterID{RESO_COMP_ID, 1},
+        "Resonance Compensation",
+        false));
+
     // === FM Modulation ===
     params.push_back(std::make_unique<juce::AudioParameterFloat>(
         juce::ParameterID{FM_AMOUNT_ID, 1},
@@ -110,6 +221,41 @@ juce::AudioProcessorValueTreeState::ParameterLayout DualCoreAudioProcessor::crea
         juce::NormalisableRange<float>(0.0f, 1.0f, 0.01f),
         0.0f));
 
+    // Cutoff modulation in octaves instead of Hz (off keeps older presets unchanged)
+    params.push_back(std::make_unique<juce::AudioParameterBool>(
+        juce::ParameterID{EXP_FREQ_MOD_ID, 1},
+        "Exponential Freq Mod",
+        false));
+
+    params.push_back(std::make_unique<juce::AudioParameterChoice>(
+        juce::ParameterID{FM_SOURCE_ID, 1},
+        "FM Source",
+        juce::StringArray{"Filter 1", "Sidechain"},
+        0));
+
+    // Cross-modulation: Filter 2 -> Filter 1, and each filter -> itself
+    params.push_back(std::make_unique<juce::AudioParameterFloat>(
+        juce::ParameterID{FM_RETURN_ID, 1},
+        "FM Return (F2 > F1)",
+        juce::NormalisableRange<float>(0.0f, 1.0f, 0.01f),
+        0.0f));
+
+    params.push_back(std::make_unique<juce::AudioParameterBool>(
+        juce::ParameterID{FM_RETURN_EXP_ID, 1},
+        "FM Return Exponential",
+        false));
+
+    params.push_back(std::make_unique<juce::AudioParameterFloat>(
+        juce::ParameterID{SELF_FM_ID, 1},
+        "Self FM",
+        juce::NormalisableRange<float>(0.0f, 1.0f, 0.01f),
+        0.0f));
+
+    params.push_back(std::make_unique<juce::AudioParameterBool>(
+        juce::ParameterID{SELF_FM_EXP_ID, 1},
+        "Self FM Exponential",
+        false));
+
     // === ADSR Envelope ===
     params.push_back(std::make_unique<juce::AudioParameterFloat>(
         juce::ParameterID{ENV_ATTACK_ID, 1},
@@ -159,6 +305,31 @@ juce::AudioProcessorValueTreeState::ParameterLayout DualCoreAudioProcessor::crea
         juce::NormalisableRange<float>(0.0f, 1.0f, 0.01f),
         0.5f));
 
+    // Trigger lookahead (delays the audio path, adds latency)
+    params.push_back(std::make_unique<juce::AudioParameterFloat>(
+        juce::ParameterID{LOOKAHEAD_ID, 1},
+        "Env Lookahead",
+        juce::NormalisableRange<float>(0.0f, DualCoreDSP::MAX_LOOKAHEAD_MS, 0.1f),
+        0.0f,
+        juce::String(),
+        juce::AudioProcessorParameter::genericParameter,
+        [](float value, int) { return value <= 0.0f ? juce::String("Off") : juce::String(value, 1) + " ms"; },
+        nullptr));
+
+    // Signal feeding the envelope trigger and the Input mod source
+    params.push_back(std::make_unique<juce::AudioParameterChoice>(
+        juce::ParameterID{DETECTOR_SOURCE_ID, 1},
+        "Detector Source",
+        juce::StringArray{"Main", "Sidechain"},
+        0));
+
+    // What triggers the envelope: the detector, MIDI notes or either
+    params.push_back(std::make_unique<juce::AudioParameterChoice>(
+        juce::ParameterID{ENV_TRIGGER_ID, 1},
+        "Env Trigger",
+        juce::StringArray{"Audio", "MIDI", "Both"},
+        0));
+
     // === LFO ===
     params.push_back(std::make_unique<juce::AudioParameterFloat>(
         juce::ParameterID{LFO_RATE_ID, 1},
@@ -200,6 +371,19 @@ juce::AudioProcessorValueTreeState::ParameterLayout DualCoreAudioProcessor::crea
                           "1/2T", "1/4T", "1/8T", "1/16T", "1/2D", "1/4D", "1/8D", "1/16D"},
         4));  // Default 1/4 note
 
+    // Audio-rate mode (0 = off): overrides rate and sync for FM/AM-style effects
+    params.push_back(std::make_unique<juce::AudioParameterFloat>(
+        juce::ParameterID{LFO_AUDIO_RATE_ID, 1},
+        "LFO1 Audio Rate",
+        juce::NormalisableRange<float>(0.0f, DualCoreDSP::MAX_LFO_AUDIO_RATE, 0.1f, 0.3f),
+        0.0f,
+        juce::String(),
+        juce::AudioProcessorParameter::genericParameter,
+        [](float value, int) { return value <= 0.0f ? juce::String("Off")
+                                     : value < 1000.0f ? juce::String(value, 1) + " Hz"
+                                                       : juce::String(value / 1000.0f, 2) + " kHz"; },
+        nullptr));
+
     // === LFO2 ===
     params.push_back(std::make_unique<juce::AudioParameterFloat>(
         juce::ParameterID{LFO2_RATE_ID, 1},
@@ -235,10 +419,26 @@ juce::AudioProcessorValueTreeState::ParameterLayout DualCoreAudioProcessor::crea
                           "1/2T", "1/4T", "1/8T", "1/16T", "1/2D", "1/4D", "1/8D", "1/16D"},
         4));
 
+    params.push_back(std::make_unique<juce::AudioParameterFloat>(
+        juce::ParameterID{LFO2_AUDIO_RATE_ID, 1},
+        "LFO2 Audio Rate",
+        juce::NormalisableRange<float>(0.0f, DualCoreDSP::MAX_LFO_AUDIO_RATE, 0.1f, 0.3f),
+        0.0f,
+        juce::String(),
+        juce::AudioProcessorParameter::genericParameter,
+        [](float value, int) { return value <= 0.0f ? juce::String("Off")
+                                     : value < 1000.0f ? juce::String(value, 1) + " Hz"
+                                                       : juce::String(value / 1000.0f, 2) + " kHz"; },
+        nullptr));
+
     // === Modulation Matrix (6 slots) ===
-    juce::StringArray modSources{"None", "LFO1", "LFO2", "Envelope", "Input"};
+    juce::StringArray modSources{"None", "LFO1", "LFO2", "Envelope", "Input", "Velocity", "Sequencer",
+                                 "Input Low", "Input Mid", "Input High", "Brightness"};
     juce::StringArray modDests{"None", "F1 Freq", "F1 Reso", "F2 Freq", "F2 Reso",
-                               "FM", "Drive", "LFO1 Rate", "LFO2 Rate", "Mix", "AM"};
+                               "FM", "Drive", "LFO1 Rate", "LFO2 Rate", "Mix", "AM",
+                               "F1 Type", "F2 Type", "F1 Morph", "F2 Morph",
+                               "LFO1 Depth", "Env Amount", "Slot 1 Amount", "Slot 2 Amount",
+                               "Slot 3 Amount", "Slot 4 Amount", "Slot 5 Amount", "Slot 6 Amount"};
 
     for (int i = 1; i <= 6; ++i)
     {
@@ -267,6 +467,147 @@ juce::AudioProcessorValueTreeState::ParameterLayout DualCoreAudioProcessor::crea
             nullptr));
     }
 
+    // === Macros (8 knobs, 16 targets shared between them) ===
+    for (int i = 1; i <= DualCoreDSP::NUM_MACROS; ++i)
+    {
+        params.push_back(std::make_unique<juce::AudioParameterFloat>(
+            juce::ParameterID{"macro" + juce::String(i), 1},
+            "Macro " + juce::String(i),
+            juce::NormalisableRange<float>(0.0f, 1.0f, 0.001f),
+            0.0f));
+    }
+
+    juce::StringArray macroNames{"None"};
+    for (int i = 1; i <= DualCoreDSP::NUM_MACROS; ++i)
+        macroNames.add("Macro " + juce::String(i));
+
+    auto percent = [](float value, int) { return juce::String(value, 0) + "%"; };
+
+    for (int i = 1; i <= DualCoreDSP::NUM_MACRO_TARGETS; ++i)
+    {
+        juce::String targetNum(i);
+
+        params.push_back(std::make_unique<juce::AudioParameterChoice>(
+            juce::ParameterID{"macroSource" + targetNum, 1},
+            "Macro Target " + targetNum + " Source",
+            macroNames,
+            0));
+
+        params.push_back(std::make_unique<juce::AudioParameterChoice>(
+            juce::ParameterID{"macroDest" + targetNum, 1},
+            "Macro Target " + targetNum + " Destination",
+            modDests,
+            0));
+
+        params.push_back(std::make_unique<juce::AudioParameterFloat>(
+            juce::ParameterID{"macroMin" + targetNum, 1},
+            "Macro Target " + targetNum + " Min",
+            juce::NormalisableRange<float>(-100.0f, 100.0f, 1.0f),
+            0.0f,
+            juce::String(),
+            juce::AudioProcessorParameter::genericParameter,
+            percent,
+            nullptr));
+
+        params.push_back(std::make_unique<juce::AudioParameterFloat>(
+            juce::ParameterID{"macroMax" + targetNum, 1},
+            "Macro Target " + targetNum + " Max",
+            juce::NormalisableRange<float>(-100.0f, 100.0f, 1.0f),
+            100.0f,
+            juce::String(),
+            juce::AudioProcessorParameter::genericParameter,
+            percent,
+            nullptr));
+
+        params.push_back(std::make_unique<juce::AudioParameterFloat>(
+            juce::ParameterID{"macroCurve" + targetNum, 1},
+            "Macro Target " + targetNum + " Curve",
+            juce::NormalisableRange<float>(-100.0f, 100.0f, 1.0f),
+            0.0f,
+            juce::String(),
+            juce::AudioProcessorParameter::genericParameter,
+            percent,
+            nullptr));
+    }
+
+    // === Step Sequencer (mod source) ===
+    params.push_back(std::make_unique<juce::AudioParameterInt>(
+        juce::ParameterID{SEQ_LENGTH_ID, 1},
+        "Sequencer Length",
+        1, DualCoreDSP::MAX_SEQ_STEPS, 16));
+
+    params.push_back(std::make_unique<juce::AudioParameterChoice>(
+        juce::ParameterID{SEQ_RATE_ID, 1},
+        "Sequencer Rate",
+        juce::StringArray{"4/1", "2/1", "1/1", "1/2", "1/4", "1/8", "1/16", "1/32",
+                          "1/2T", "1/4T", "1/8T", "1/16T", "1/2D", "1/4D", "1/8D", "1/16D"},
+        6));  // Default 1/16
+
+    params.push_back(std::make_unique<juce::AudioParameterFloat>(
+        juce::ParameterID{SEQ_GATE_LENGTH_ID, 1},
+        "Sequencer Gate Length",
+        juce::NormalisableRange<float>(0.05f, 1.0f, 0.01f),
+        0.5f));
+
+    for (int i = 1; i <= DualCoreDSP::MAX_SEQ_STEPS; ++i)
+    {
+        juce::String stepNum(i);
+
+        params.push_back(std::make_unique<juce::AudioParameterFloat>(
+            juce::ParameterID{"seqValue" + stepNum, 1},
+            "Seq Step " + stepNum + " Value",
+            juce::NormalisableRange<float>(-100.0f, 100.0f, 1.0f),
+            100.0f,
+            juce::String(),
+            juce::AudioProcessorParameter::genericParameter,
+            percent,
+            nullptr));
+
+        params.push_back(std::make_unique<juce::AudioParameterBool>(
+            juce::ParameterID{"seqGate" + stepNum, 1},
+            "Seq Step " + stepNum + " Gate",
+            true));
+
+        params.push_back(std::make_unique<juce::AudioParameterBool>(
+            juce::ParameterID{"seqGlide" + stepNum, 1},
+            "Seq Step " + stepNum + " Glide",
+            false));
+    }
+
+    // === Snapshots ===
+    params.push_back(std::make_unique<juce::AudioParameterChoice>(
+        juce::ParameterID{SNAPSHOT_MODE_ID, 1},
+        "Snapshot Mode",
+        juce::StringArray{"Off", "Manual", "Step", "Glide"},
+        0));
+
+    params.push_back(std::make_unique<juce::AudioParameterInt>(
+        juce::ParameterID{SNAPSHOT_SELECT_ID, 1},
+        "Snapshot Select",
+        1, DualCoreDSP::NUM_SNAPSHOTS, 1));
+
+    params.push_back(std::make_unique<juce::AudioParameterInt>(
+        juce::ParameterID{SNAPSHOT_COUNT_ID, 1},
+        "Snapshot Count",
+        1, DualCoreDSP::NUM_SNAPSHOTS, 4));
+
+    params.push_back(std::make_unique<juce::AudioParameterChoice>(
+        juce::ParameterID{SNAPSHOT_RATE_ID, 1},
+        "Snapshot Rate",
+        juce::StringArray{"4/1", "2/1", "1/1", "1/2", "1/4", "1/8", "1/16", "1/32",
+                          "1/2T", "1/4T", "1/8T", "1/16T", "1/2D", "1/4D", "1/8D", "1/16D"},
+        2));  // Default 1/1
+
+    params.push_back(std::make_unique<juce::AudioParameterFloat>(
+        juce::ParameterID{SNAPSHOT_FADE_ID, 1},
+        "Snapshot Fade",
+        juce::NormalisableRange<float>(1.0f, DualCoreDSP::MAX_SNAPSHOT_FADE_MS, 1.0f, 0.4f),
+        10.0f,
+        juce::String(),
+        juce::AudioProcessorParameter::genericParameter,
+        [](float value, int) { return juce::String(value, 0) + " ms"; },
+        nullptr));
+
     // === AM ===
     params.push_back(std::make_unique<juce::AudioParameterFloat>(
         juce::ParameterID{AM_AMOUNT_ID, 1},
@@ -304,7 +645,7 @@ juce::AudioProcessorValueTreeState::ParameterLayout DualCoreAudioProcessor::crea
     params.push_back(std::make_unique<juce::AudioParameterChoice>(
         juce::ParameterID{DRIVE_TYPE_ID, 1},
         "Drive Type",
-        juce::StringArray{"Soft", "Tube", "Tape", "Hard", "Fuzz"},
+        juce::StringArray{"Soft", "Tube", "Tape", "Hard", "Fuzz", "Fold", "Crush"},
         0));
 
     params.push_back(std::make_unique<juce::AudioParameterBool>(
@@ -313,10 +654,34 @@ juce::AudioProcessorValueTreeState::ParameterLayout DualCoreAudioProcessor::crea
         true));
 
     // === Routing ===
-    params.push_back(std::make_unique<juce::AudioParameterBool>(
+    // Was a bool (Series/Parallel); the first two choices keep those values
+    params.push_back(std::make_unique<juce::AudioParameterChoice>(
         juce::ParameterID{ROUTING_ID, 1},
-        "Parallel Routing",
-        false));
+        "Routing",
+        juce::StringArray{"Series", "Parallel", "Split", "Feedback", "Cascade"},
+        0));
+
+    params.push_back(std::make_unique<juce::AudioParameterFloat>(
+        juce::ParameterID{ROUTING_BALANCE_ID, 1},
+        "Parallel Balance",
+        juce::NormalisableRange<float>(0.0f, 1.0f, 0.01f),
+        0.5f));
+
+    params.push_back(std::make_unique<juce::AudioParameterFloat>(
+        juce::ParameterID{FEEDBACK_AMOUNT_ID, 1},
+        "Feedback Amount",
+        juce::NormalisableRange<float>(0.0f, 0.95f, 0.01f),
+        0.0f));
+
+    params.push_back(std::make_unique<juce::AudioParameterFloat>(
+        juce::ParameterID{FEEDBACK_DELAY_ID, 1},
+        "Feedback Delay",
+        juce::NormalisableRange<float>(0.0f, DualCoreDSP::MAX_FEEDBACK_DELAY_MS, 0.1f),
+        0.0f,
+        juce::String(),
+        juce::AudioProcessorParameter::genericParameter,
+        [](float value, int) { return value <= 0.0f ? juce::String("1 smp") : juce::String(value, 1) + " ms"; },
+        nullptr));
 
     params.push_back(std::make_unique<juce::AudioParameterFloat>(
         juce::ParameterID{MIX_ID, 1},
@@ -328,6 +693,140 @@ juce::AudioProcessorValueTreeState::ParameterLayout DualCoreAudioProcessor::crea
         [](float value, int) { return juce::String(value, 0) + "%"; },
         nullptr));
 
+    // === Stereo ===
+    params.push_back(std::make_unique<juce::AudioParameterBool>(
+        juce::ParameterID{MID_SIDE_ID, 1},
+        "Mid/Side",
+        false));
+
+    params.push_back(std::make_unique<juce::AudioParameterBool>(
+        juce::ParameterID{SIDE_LINK_ID, 1},
+        "Side Link",
+        true));
+
+    params.push_back(std::make_unique<juce::AudioParameterFloat>(
+        juce::ParameterID{SIDE_FREQ_OFFSET_ID, 1},
+        "Side Freq Offset",
+        juce::NormalisableRange<float>(-4.0f, 4.0f, 0.01f),
+        0.0f,
+        juce::String(),
+        juce::AudioProcessorParameter::genericParameter,
+        [](float value, int) { return (value > 0.0f ? "+" : "") + juce::String(value, 2) + " oct"; },
+        nullptr));
+
+    params.push_back(std::make_unique<juce::AudioParameterFloat>(
+        juce::ParameterID{SIDE_RESO_OFFSET_ID, 1},
+        "Side Reso Offset",
+        juce::NormalisableRange<float>(-1.0f, 1.0f, 0.01f),
+        0.0f));
+
+    params.push_back(std::make_unique<juce::AudioParameterFloat>(
+        juce::ParameterID{STEREO_SPREAD_ID, 1},
+        "Stereo Spread",
+        juce::NormalisableRange<float>(0.0f, 1.0f, 0.01f),
+        0.0f));
+
+    params.push_back(std::make_unique<juce::AudioParameterFloat>(
+        juce::ParameterID{DRIFT_ID, 1},
+        "Analog Drift",
+        juce::NormalisableRange<float>(0.0f, 100.0f, 1.0f),
+        0.0f,
+        juce::String(),
+        juce::AudioProcessorParameter::genericParameter,
+        [](float value, int) { return juce::String(value, 0) + "%"; },
+        nullptr));
+
+    // === Unison ===
+    params.push_back(std::make_unique<juce::AudioParameterInt>(
+        juce::ParameterID{UNISON_VOICES_ID, 1},
+        "Unison Voices",
+        1, DualCoreDSP::MAX_UNISON_VOICES,
+        1));
+
+    params.push_back(std::make_unique<juce::AudioParameterFloat>(
+        juce::ParameterID{UNISON_DETUNE_ID, 1},
+        "Unison Detune",
+        juce::NormalisableRange<float>(0.0f, 1.0f, 0.01f),
+        0.0f));
+
+    params.push_back(std::make_unique<juce::AudioParameterFloat>(
+        juce::ParameterID{UNISON_RESO_SPREAD_ID, 1},
+        "Unison Reso Spread",
+        juce::NormalisableRange<float>(0.0f, 1.0f, 0.01f),
+        0.0f));
+
+    // === Poly ===
+    params.push_back(std::make_unique<juce::AudioParameterBool>(
+        juce::ParameterID{POLY_MODE_ID, 1},
+        "Poly Mode",
+        false));
+
+    params.push_back(std::make_unique<juce::AudioParameterFloat>(
+        juce::ParameterID{KEY_TRACK_ID, 1},
+        "Key Tracking",
+        juce::NormalisableRange<float>(0.0f, 1.0f, 0.01f),
+        1.0f));
+
+    params.push_back(std::make_unique<juce::AudioParameterBool>(
+        juce::ParameterID{LFO_RETRIGGER_ID, 1},
+        "LFO Retrigger",
+        false));
+
+    // === Multiband ===
+    params.push_back(std::make_unique<juce::AudioParameterChoice>(
+        juce::ParameterID{BAND_COUNT_ID, 1},
+        "Bands",
+        juce::StringArray{"Off", "2 Bands", "3 Bands", "4 Bands"},
+        0));
+
+    auto addCrossover = [&params](const char* paramID, const juce::String& name,
+                                  float minFreq, float maxFreq, float defaultFreq)
+    {
+        params.push_back(std::make_unique<juce::AudioParameterFloat>(
+            juce::ParameterID{paramID, 1},
+            "Crossover " + name,
+            juce::NormalisableRange<float>(minFreq, maxFreq, 0.1f, 0.3f),
+            defaultFreq,
+            juce::String(),
+            juce::AudioProcessorParameter::genericParameter,
+            [](float value, int) { return juce::String(value, 0) + " Hz"; },
+            nullptr));
+    };
+
+    addCrossover(CROSSOVER_LOW_ID, "Low", 40.0f, 1000.0f, 200.0f);
+    addCrossover(CROSSOVER_MID_ID, "Mid", 200.0f, 8000.0f, 1000.0f);
+    addCrossover(CROSSOVER_HIGH_ID, "High", 1000.0f, 16000.0f, 5000.0f);
+
+    auto addBand = [&params](const char* offsetID, const char* driveID, const char* mixID, const juce::String& name)
+    {
+        params.push_back(std::make_unique<juce::AudioParameterFloat>(
+            juce::ParameterID{offsetID, 1},
+            name + " Freq Offset",
+            juce::NormalisableRange<float>(-4.0f, 4.0f, 0.01f),
+            0.0f));
+
+        params.push_back(std::make_unique<juce::AudioParameterFloat>(
+            juce::ParameterID{driveID, 1},
+            name + " Drive",
+            juce::NormalisableRange<float>(0.0f, 1.0f, 0.01f),
+            0.0f));
+
+        params.push_back(std::make_unique<juce::AudioParameterFloat>(
+            juce::ParameterID{mixID, 1},
+            name + " Mix",
+            juce::NormalisableRange<float>(0.0f, 100.0f, 1.0f),
+            100.0f,
+            juce::String(),
+            juce::AudioProcessorParameter::genericParameter,
+            [](float value, int) { return juce::String(value, 0) + "%"; },
+            nullptr));
+    };
+
+    addBand(BAND1_OFFSET_ID, BAND1_DRIVE_ID, BAND1_MIX_ID, "Band 1");
+    addBand(BAND2_OFFSET_ID, BAND2_DRIVE_ID, BAND2_MIX_ID, "Band 2");
+    addBand(BAND3_OFFSET_ID, BAND3_DRIVE_ID, BAND3_MIX_ID, "Band 3");
+    addBand(BAND4_OFFSET_ID, BAND4_DRIVE_ID, BAND4_MIX_ID, "Band 4");
+
     return {params.begin(), params.end()};
 }
 
@@ -336,7 +835,7 @@ const juce::String DualCoreAudioProcessor::getName() const
     return JucePlugin_Name;
 }
 
-bool DualCoreAudioProcessor::acceptsMidi() const { return false; }
+bool DualCoreAudioProcessor::acceptsMidi() const { return true; }
 bool DualCoreAudioProcessor::producesMidi() const { return false; }
 bool DualCoreAudioProcessor::isMidiEffect() const { return false; }
 double DualCoreAudioProcessor::getTailLengthSeconds() const { return 0.0; }
@@ -351,6 +850,8 @@ void DualCoreAudioProcessor::prepareToPlay(double sampleRate, int samplesPerBloc
 {
     dualCoreDSP.prepare(sampleRate, samplesPerBlock);
     updateDSPFromParameters();
+    applyPendingSnapshots();
+    setLatencySamples(dualCoreDSP.getLatencySamples());
 }
 
 void DualCoreAudioProcessor::releaseResources()
@@ -358,16 +859,97 @@ void DualCoreAudioProcessor::releaseResources()
     dualCoreDSP.reset();
 }
 
+void DualCoreAudioProcessor::assignAuxOutputs(juce::AudioBuffer<float>& buffer, int numMainChannels)
+{
+    dualCoreDSP.clearTapOutputs();
+
+    const int auxMode = static_cast<int>(*apvts.getRawParameterValue(AUX_MODE_ID));
+    std::array<std::array<DualCoreDSP::TapOutputs, DualCoreDSP::MAX_CHANNELS>, 2> taps{};
+    bool filterUsed[2] = {false, false};
+
+    for (int aux = 0; aux < NUM_AUX_BUSES; ++aux)
+    {
+        // Disabled buses are never touched
+        const int busIndex = aux + 1;
+        if (busIndex >= getBusCount(false) || !getBus(false, busIndex)->isEnabled())
+            continue;
+
+        auto auxBuffer = getBusBuffer(buffer, false, busIndex);
+        const int numChannels = juce::jmin(auxBuffer.getNumChannels(), numMainChannels, DualCoreDSP::MAX_CHANNELS);
+
+        for (int ch = 0; ch < numChannels; ++ch)
+        {
+            float* destination = auxBuffer.getWritePointer(ch);
+
+            if (auxMode == 0)
+            {
+                // Filter 1, Filter 2, Dry
+                if (aux == 2)
+                {
+                    dualCoreDSP.setDryOutput(ch, destination);
+                }
+                else
+                {
+                    taps[static_cast<size_t>(aux)][static_cast<size_t>(ch)].filtered = destination;
+                    filterUsed[aux] = true;
+                }
+            }
+            else
+            {
+                // LP, BP, HP of the chosen filter
+                const int filterIndex = auxMode - 1;
+                auto& filterTaps = taps[static_cast<size_t>(filterIndex)][static_cast<size_t>(ch)];
+                if (aux == 0)      filterTaps.lowpass = destination;
+                else if (aux == 1) filterTaps.bandpass = destination;
+                else               filterTaps.highpass = destination;
+                filterUsed[filterIndex] = true;
+            }
+        }
+
+        // Channels beyond the main bus have no source
+        for (int ch = numChannels; ch < auxBuffer.getNumChannels(); ++ch)
+            auxBuffer.clear(ch, 0, auxBuffer.getNumSamples());
+    }
+
+    for (int filterIndex = 0; filterIndex < 2; ++filterIndex)
+    {
+        if (!filterUsed[filterIndex])
+            continue;
+
+        for (int ch = 0; ch < juce::jmin(numMainChannels, DualCoreDSP::MAX_CHANNELS); ++ch)
+            dualCoreDSP.setTapOutputs(filterIndex, ch, taps[static_cast<size_t>(filterIndex)][static_cast<size_t>(ch)]);
+    }
+}
+
 #ifndef JucePlugin_PreferredChannelConfigurations
 bool DualCoreAudioProcessor::isBusesLayoutSupported(const BusesLayout& layouts) const
 {
-    if (layouts.getMainOutputChannelSet() != juce::AudioChannelSet::mono()
-        && layouts.getMainOutputChannelSet() != juce::AudioChannelSet::stereo())
+    // Any layout from mono up to 7.1.4 (12 discrete channels)
+    const auto mainSet = layouts.getMainOutputChannelSet();
+    if (mainSet.isDisabled() || mainSet.size() > DualCoreDSP::MAX_CHANNELS)
         return false;
 
     if (layouts.getMainOutputChannelSet() != layouts.getMainInputChannelSet())
         return false;
 
+    // Optional sidechain: off, mono or stereo
+    if (layouts.inputBuses.size() > 1)
+    {
+        const auto sidechainSet = layouts.getChannelSet(true, 1);
+        if (!sidechainSet.isDisabled()
+            && sidechainSet != juce::AudioChannelSet::mono()
+            && sidechainSet != juce::AudioChannelSet::stereo())
+            return false;
+    }
+
+    // Aux outputs: off, or up to the main bus channel count (channels map one to one)
+    for (int bus = 1; bus < layouts.outputBuses.size(); ++bus)
+    {
+        const auto auxSet = layouts.getChannelSet(false, bus);
+        if (!auxSet.isDisabled() && auxSet.size() > mainSet.size())
+            return false;
+    }
+
     return true;
 }
 #endif
@@ -379,6 +961,34 @@ void DualCoreAudioProcessor::updateDSPFromParameters()
     dualCoreDSP.setHiBoost(*apvts.getRawParameterValue(HI_BOOST_ID) > 0.5f);
     dualCoreDSP.setHiCut(*apvts.getRawParameterValue(HI_CUT_ID) > 0.5f);
     dualCoreDSP.setLimiterEnabled(*apvts.getRawParameterValue(LIMITER_ID) > 0.5f);
+    dualCoreDSP.setOutputLimiterEnabled(*apvts.getRawParameterValue(OUTPUT_LIMITER_ID) > 0.5f);
+    dualCoreDSP.setLimiterCeiling(*apvts.getRawParameterValue(LIMITER_CEILING_ID));
+
+    // Centre/LFE exclusion (centre only counts in layouts wider than stereo; mono is a centre channel)
+    const bool excludeCentreLFE = *apvts.getRawParameterValue(EXCLUDE_CENTRE_LFE_ID) > 0.5f;
+    const auto mainLayout = getChannelLayoutOfBus(false, 0);
+    for (int ch = 0; ch < DualCoreDSP::MAX_CHANNELS; ++ch)
+    {
+        const auto channelType = mainLayout.getTypeOfChannel(ch);
+        const bool isCentre = channelType == juce::AudioChannelSet::centre && mainLayout.size() > 2;
+        const bool isLFE = channelType == juce::AudioChannelSet::LFE || channelType == juce::AudioChannelSet::LFE2;
+        dualCoreDSP.setChannelExcluded(ch, excludeCentreLFE && (isCentre || isLFE));
+    }
+
+    // Input EQ
+    const char* eqBandIDs[DualCoreDSP::NUM_EQ_BANDS][3] = {
+        {EQ_LOW_FREQ_ID, EQ_LOW_GAIN_ID, EQ_LOW_Q_ID},
+        {EQ_MID1_FREQ_ID, EQ_MID1_GAIN_ID, EQ_MID1_Q_ID},
+        {EQ_MID2_FREQ_ID, EQ_MID2_GAIN_ID, EQ_MID2_Q_ID},
+        {EQ_HIGH_FREQ_ID, EQ_HIGH_GAIN_ID, EQ_HIGH_Q_ID}
+    };
+    for (int band = 0; band < DualCoreDSP::NUM_EQ_BANDS; ++band)
+    {
+        dualCoreDSP.setEQBand(band,
+                              *apvts.getRawParameterValue(eqBandIDs[band][0]),
+                              *apvts.getRawParameterValue(eqBandIDs[band][1]),
+                              *apvts.getRawParameterValue(eqBandIDs[band][2]));
+    }
 
     // Filter 1
     dualCoreDSP.setFilter1Frequency(*apvts.getRawParameterValue(FILTER1_FREQ_ID));
@@ -387,6 +997,7 @@ void DualCoreAudioProcessor::updateDSPFromParameters()
         static_cast<int>(*apvts.getRawParameterValue(FILTER1_MODE_ID))));
     dualCoreDSP.setFilter1Type(static_cast<DualCoreDSP::FilterType>(
         static_cast<int>(*apvts.getRawParameterValue(FILTER1_TYPE_ID))));
+    dualCoreDSP.setFilter1Morph(*apvts.getRawParameterValue(FILTER1_MORPH_ID));
 
     // Filter 2
     dualCoreDSP.setFilter2Frequency(*apvts.getRawParameterValue(FILTER2_FREQ_ID));
@@ -395,9 +1006,20 @@ void DualCoreAudioProcessor::updateDSPFromParameters()
         static_cast<int>(*apvts.getRawParameterValue(FILTER2_MODE_ID))));
     dualCoreDSP.setFilter2Type(static_cast<DualCoreDSP::FilterType>(
         static_cast<int>(*apvts.getRawParameterValue(FILTER2_TYPE_ID))));
+    dualCoreDSP.setFilter2Morph(*apvts.getRawParameterValue(FILTER2_MORPH_ID));
+    dualCoreDSP.setResonanceCompensation(*apvts.getRawParameterValue(RESO_COMP_ID) > 0.5f);
 
     // FM
     dualCoreDSP.setFMAmount(*apvts.getRawParameterValue(FM_AMOUNT_ID));
+    dualCoreDSP.setExponentialFreqMod(*apvts.getRawParameterValue(EXP_FREQ_MOD_ID) > 0.5f);
+    dualCoreDSP.setFMSource(static_cast<DualCoreDSP::FMSource>(
+        static_cast<int>(*apvts.getRawParameterValue(FM_SOURCE_ID))));
+    dualCoreDSP.setCrossMod(DualCoreDSP::CrossModPath::Filter2ToFilter1,
+                            *apvts.getRawParameterValue(FM_RETURN_ID),
+                            *apvts.getRawParameterValue(FM_RETURN_EXP_ID) > 0.5f);
+    dualCoreDSP.setCrossMod(DualCoreDSP::CrossModPath::SelfFM,
+                            *apvts.getRawParameterValue(SELF_FM_ID),
+                            *apvts.getRawParameterValue(SELF_FM_EXP_ID) > 0.5f);
 
     // ADSR
     dualCoreDSP.setEnvAttack(*apvts.getRawParameterValue(ENV_ATTACK_ID));
@@ -406,6 +1028,11 @@ void DualCoreAudioProcessor::updateDSPFromParameters()
     dualCoreDSP.setEnvRelease(*apvts.getRawParameterValue(ENV_RELEASE_ID));
     dualCoreDSP.setEnvAmount(*apvts.getRawParameterValue(ENV_AMOUNT_ID));
     dualCoreDSP.setEnvSensitivity(*apvts.getRawParameterValue(ENV_SENS_ID));
+    dualCoreDSP.setLookahead(*apvts.getRawParameterValue(LOOKAHEAD_ID));
+    dualCoreDSP.setDetectorSource(static_cast<DualCoreDSP::DetectorSource>(
+        static_cast<int>(*apvts.getRawParameterValue(DETECTOR_SOURCE_ID))));
+    dualCoreDSP.setEnvTrigger(static_cast<DualCoreDSP::EnvTrigger>(
+        static_cast<int>(*apvts.getRawParameterValue(ENV_TRIGGER_ID))));
 
     // LFO1
     dualCoreDSP.setLFORate(*apvts.getRawParameterValue(LFO_RATE_ID));
@@ -416,6 +1043,7 @@ void DualCoreAudioProcessor::updateDSPFromParameters()
     dualCoreDSP.setLFODivision(static_cast<DualCoreDSP::NoteDivision>(
         static_cast<int>(*apvts.getRawParameterValue(LFO_DIV_ID))));
     dualCoreDSP.setLFOSync(*apvts.getRawParameterValue(LFO_SYNC_ID) > 0.5f);
+    dualCoreDSP.setLFOAudioRate(*apvts.getRawParameterValue(LFO_AUDIO_RATE_ID));
 
     // LFO2
     dualCoreDSP.setLFO2Rate(*apvts.getRawParameterValue(LFO2_RATE_ID));
@@ -425,6 +1053,7 @@ void DualCoreAudioProcessor::updateDSPFromParameters()
     dualCoreDSP.setLFO2Division(static_cast<DualCoreDSP::NoteDivision>(
         static_cast<int>(*apvts.getRawParameterValue(LFO2_DIV_ID))));
     dualCoreDSP.setLFO2Sync(*apvts.getRawParameterValue(LFO2_SYNC_ID) > 0.5f);
+    dualCoreDSP.setLFO2AudioRate(*apvts.getRawParameterValue(LFO2_AUDIO_RATE_ID));
 
     // Modulation Matrix
     for (int i = 1; i <= 6; ++i)
@@ -440,6 +1069,42 @@ void DualCoreAudioProcessor::updateDSPFromParameters()
             amount);
     }
 
+    // Macros: knob values, plus targets that only recompile the routing when they change
+    for (int i = 0; i < DualCoreDSP::NUM_MACROS; ++i)
+        dualCoreDSP.setMacro(i, macroParameters[static_cast<size_t>(i)]->load());
+
+    for (int i = 0; i < DualCoreDSP::NUM_MACRO_TARGETS; ++i)
+    {
+        const auto& targetParams = macroTargetParameters[static_cast<size_t>(i)];
+        DualCoreDSP::MacroTarget target;
+        target.macro = static_cast<int>(targetParams.source->load()) - 1;
+        target.destination = static_cast<DualCoreDSP::ModDestination>(static_cast<int>(targetParams.destination->load()));
+        target.rangeMin = targetParams.rangeMin->load() / 100.0f;
+        target.rangeMax = targetParams.rangeMax->load() / 100.0f;
+        target.curve = targetParams.curve->load() / 100.0f;
+        dualCoreDSP.setMacroTarget(i, target);
+    }
+
+    // Step Sequencer
+    dualCoreDSP.setSequencerLength(static_cast<int>(*apvts.getRawParameterValue(SEQ_LENGTH_ID)));
+    dualCoreDSP.setSequencerDivision(static_cast<DualCoreDSP::NoteDivision>(
+        static_cast<int>(*apvts.getRawParameterValue(SEQ_RATE_ID))));
+    dualCoreDSP.setSequencerGateLength(*apvts.getRawParameterValue(SEQ_GATE_LENGTH_ID));
+    for (int i = 0; i < DualCoreDSP::MAX_SEQ_STEPS; ++i)
+    {
+        const auto& step = sequencerStepParameters[static_cast<size_t>(i)];
+        dualCoreDSP.setSequencerStep(i, step.value->load() / 100.0f,
+                                     step.gate->load() > 0.5f, step.glide->load() > 0.5f);
+    }
+
+    dualCoreDSP.setSnapshotMode(static_cast<DualCoreDSP::SnapshotMode>(
+        static_cast<int>(*apvts.getRawParameterValue(SNAPSHOT_MODE_ID))));
+    dualCoreDSP.setSnapshotSelect(static_cast<int>(*apvts.getRawParameterValue(SNAPSHOT_SELECT_ID)) - 1);
+    dualCoreDSP.setSnapshotSequence(static_cast<int>(*apvts.getRawParameterValue(SNAPSHOT_COUNT_ID)),
+                                    static_cast<DualCoreDSP::NoteDivision>(
+                                        static_cast<int>(*apvts.getRawParameterValue(SNAPSHOT_RATE_ID))));
+    dualCoreDSP.setSnapshotFade(*apvts.getRawParameterValue(SNAPSHOT_FADE_ID));
+
     // AM
     dualCoreDSP.setAMAmount(*apvts.getRawParameterValue(AM_AMOUNT_ID));
     dualCoreDSP.setAMAttack(*apvts.getRawParameterValue(AM_ATTACK_ID));
@@ -452,43 +1117,112 @@ void DualCoreAudioProcessor::updateDSPFromParameters()
     dualCoreDSP.setDrivePrePost(*apvts.getRawParameterValue(DRIVE_PRE_POST_ID) > 0.5f);
 
     // Routing
-    dualCoreDSP.setFilterRouting(*apvts.getRawParameterValue(ROUTING_ID) > 0.5f);
+    dualCoreDSP.setFilterRouting(static_cast<DualCoreDSP::FilterRouting>(
+        static_cast<int>(*apvts.getRawParameterValue(ROUTING_ID))));
+    dualCoreDSP.setRoutingBalance(*apvts.getRawParameterValue(ROUTING_BALANCE_ID));
+    dualCoreDSP.setFeedback(*apvts.getRawParameterValue(FEEDBACK_AMOUNT_ID),
+                            *apvts.getRawParameterValue(FEEDBACK_DELAY_ID));
     dualCoreDSP.setDryWetMix(*apvts.getRawParameterValue(MIX_ID) / 100.0f);
+
+    // Stereo
+    dualCoreDSP.setMidSide(*apvts.getRawParameterValue(MID_SIDE_ID) > 0.5f);
+    dualCoreDSP.setSideLink(*apvts.getRawParameterValue(SIDE_LINK_ID) > 0.5f);
+    dualCoreDSP.setSideFreqOffset(*apvts.getRawParameterValue(SIDE_FREQ_OFFSET_ID));
+    dualCoreDSP.setSideResoOffset(*apvts.getRawParameterValue(SIDE_RESO_OFFSET_ID));
+    dualCoreDSP.setStereoSpread(*apvts.getRawParameterValue(STEREO_SPREAD_ID));
+    dualCoreDSP.setDriftSeed(driftSeed.load());
+    dualCoreDSP.setDrift(*apvts.getRawParameterValue(DRIFT_ID) / 100.0f);
+
+    // Unison
+    dualCoreDSP.setUnison(static_cast<int>(*apvts.getRawParameterValue(UNISON_VOICES_ID)),
+                          *apvts.getRawParameterValue(UNISON_DETUNE_ID),
+                          *apvts.getRawParameterValue(UNISON_RESO_SPREAD_ID));
+
+    // Poly
+    dualCoreDSP.setPolyMode(*apvts.getRawParameterValue(POLY_MODE_ID) > 0.5f);
+    dualCoreDSP.setKeyTracking(*apvts.getRawParameterValue(KEY_TRACK_ID));
+    dualCoreDSP.setLFORetrigger(*apvts.getRawParameterValue(LFO_RETRIGGER_ID) > 0.5f);
+
+    // Multiband
+    dualCoreDSP.setBandCount(static_cast<int>(*apvts.getRawParameterValue(BAND_COUNT_ID)) + 1);
+    dualCoreDSP.setCrossover(0, *apvts.getRawParameterValue(CROSSOVER_LOW_ID));
+    dualCoreDSP.setCrossover(1, *apvts.getRawParameterValue(CROSSOVER_MID_ID));
+    dualCoreDSP.setCrossover(2, *apvts.getRawParameterValue(CROSSOVER_HIGH_ID));
+
+    const char* bandIDs[DualCoreDSP::MAX_BANDS][3] = {
+        {BAND1_OFFSET_ID, BAND1_DRIVE_ID, BAND1_MIX_ID},
+        {BAND2_OFFSET_ID, BAND2_DRIVE_ID, BAND2_MIX_ID},
+        {BAND3_OFFSET_ID, BAND3_DRIVE_ID, BAND3_MIX_ID},
+        {BAND4_OFFSET_ID, BAND4_DRIVE_ID, BAND4_MIX_ID}
+    };
+    for (int band = 0; band < DualCoreDSP::MAX_BANDS; ++band)
+    {
+        dualCoreDSP.setBand(band,
+                            *apvts.getRawParameterValue(bandIDs[band][0]),
+                            *apvts.getRawParameterValue(bandIDs[band][1]),
+                            *apvts.getRawParameterValue(bandIDs[band][2]) / 100.0f);
+    }
 }
 
 void DualCoreAudioProcessor::processBlock(juce::AudioBuffer<float>& buffer,
-                                           juce::MidiBuffer& /*midiMessages*/)
+                                           juce::MidiBuffer& midiMessages)
 {
     juce::ScopedNoDenormals noDenormals;
 
-    // Get BPM from host
+    // Get BPM and transport position from host (the sequencer free-runs without a position)
+    bool hostPlaying = false;
+    double hostPpq = 0.0;
     if (auto* playHead = getPlayHead())
     {
         if (auto position = playHead->getPosition())
         {
             if (auto bpm = position->getBpm())
                 dualCoreDSP.setHostBPM(*bpm);
+            if (auto ppq = position->getPpqPosition())
+            {
+                hostPpq = *ppq;
+                hostPlaying = position->getIsPlaying();
+            }
         }
     }
+    dualCoreDSP.setHostPosition(hostPpq, hostPlaying);
 
     updateDSPFromParameters();
+    applyPendingSnapshots();
+
+    // Lookahead and limiters change the plugin latency
+    if (dualCoreDSP.getLatencySamples() != getLatencySamples())
+        setLatencySamples(dualCoreDSP.getLatencySamples());
+
+    // Main bus is processed in place; the sidechain bus (if connected) only feeds modulation
+    auto mainBuffer = getBusBuffer(buffer, false, 0);
+    juce::AudioBuffer<float> sidechainBuffer;
+    if (getBusCount(true) > 1 && getBus(true, 1)->isEnabled())
+        sidechainBuffer = getBusBuffer(buffer, true, 1);
+    const bool hasSidechain = sidechainBuffer.getNumChannels() > 0;
 
     // Input metering
-    if (buffer.getNumChannels() > 0)
+    if (mainBuffer.getNumChannels() > 0)
     {
-        inputLevelL.store(buffer.getMagnitude(0, 0, buffer.getNumSamples()));
-        if (buffer.getNumChannels() > 1)
-            inputLevelR.store(buffer.getMagnitude(1, 0, buffer.getNumSamples()));
+        inputLevelL.store(mainBuffer.getMagnitude(0, 0, mainBuffer.getNumSamples()));
+        if (mainBuffer.getNumChannels() > 1)
+            inputLevelR.store(mainBuffer.getMagnitude(1, 0, mainBuffer.getNumSamples()));
     }
 
-    dualCoreDSP.process(buffer);
+    // Aux buses are written by the DSP directly; this must follow the sidechain read,
+    // since host buffers can share channels between input and output buses
+    assignAuxOutputs(buffer, mainBuffer.getNumChannels());
+
+    dualCoreDSP.process(mainBuffer, hasSidechain ? &sidechainBuffer : nullptr, &midiMessages);
+    sequencerStep.store(dualCoreDSP.getSequencerStep());
+    activeSnapshot.store(dualCoreDSP.getActiveSnapshot());
 
     // Output metering
-    if (buffer.getNumChannels() > 0)
+    if (mainBuffer.getNumChannels() > 0)
     {
-        outputLevelL.store(buffer.getMagnitude(0, 0, buffer.getNumSamples()));
-        if (buffer.getNumChannels() > 1)
-            outputLevelR.store(buffer.getMagnitude(1, 0, buffer.getNumSamples()));
+        outputLevelL.store(mainBuffer.getMagnitude(0, 0, mainBuffer.getNumSamples()));
+        if (mainBuffer.getNumChannels() > 1)
+            outputLevelR.store(mainBuffer.getMagnitude(1, 0, mainBuffer.getNumSamples()));
     }
 }
 
@@ -503,6 +1237,7 @@ void DualCoreAudioProcessor::getStateInformation(juce::MemoryBlock& destData)
 {
     auto state = apvts.copyState();
     state.setProperty("uiScale", uiScale.load(), nullptr);
+    state.setProperty("driftSeed", static_cast<int>(driftSeed.load()), nullptr);
     std::unique_ptr<juce::XmlElement> xml(state.createXml());
     copyXmlToBinary(*xml, destData);
 }
@@ -515,8 +1250,137 @@ void DualCoreAudioProcessor::setStateInformation(const void* data, int sizeInByt
     {
         apvts.replaceState(juce::ValueTree::fromXml(*xmlState));
         uiScale.store(static_cast<float>(apvts.state.getProperty("uiScale", 1.0f)));
-        updateDSPFromParameters();
+        if (apvts.state.hasProperty("driftSeed"))
+            driftSeed.store(static_cast<uint32_t>(static_cast<int>(apvts.state.getProperty("driftSeed"))));
+        loadSnapshotsFromState();
+    }
+}
+
+// === Snapshots ===
+
+namespace
+{
+    juce::Identifier getSnapshotType(int index)
+    {
+        return "Snapshot" + juce::String(index + 1);
+    }
+}
+
+void DualCoreAudioProcessor::applyPendingSnapshots()
+{
+    // Newly stored slots are prepared here, on the thread that reads the routing tables,
+    // and skipped for a block if the message thread is still writing them
+    const juce::SpinLock::ScopedTryLockType lock(snapshotLock);
+    if (!lock.isLocked() || !snapshotsChanged)
+        return;
+
+    for (int i = 0; i < DualCoreDSP::NUM_SNAPSHOTS; ++i)
+    {
+        if (pendingSnapshotStored[static_cast<size_t>(i)])
+            dualCoreDSP.setSnapshot(i, pendingSnapshots[static_cast<size_t>(i)]);
+        else
+            dualCoreDSP.clearSnapshot(i);
+    }
+    snapshotsChanged = false;
+}
+
+void DualCoreAudioProcessor::storeSnapshot(int index)
+{
+    if (index < 0 || index >= DualCoreDSP::NUM_SNAPSHOTS)
+        return;
+
+    auto snapshots = apvts.state.getOrCreateChildWithName("Snapshots", nullptr);
+    auto snapshot = snapshots.getOrCreateChildWithName(getSnapshotType(index), nullptr);
+
+    auto capture = [this, &snapshot](const juce::String& paramID)
+    {
+        snapshot.setProperty(paramID, apvts.getRawParameterValue(paramID)->load(), nullptr);
+    };
+    // Everything DualCoreDSP::Snapshot holds
+    for (const auto* paramID : { FILTER1_FREQ_ID, FILTER1_RESO_ID, FILTER1_MODE_ID, FILTER1_TYPE_ID, FILTER1_MORPH_ID,
+                                 FILTER2_FREQ_ID, FILTER2_RESO_ID, FILTER2_MODE_ID, FILTER2_TYPE_ID, FILTER2_MORPH_ID,
+                                 FM_AMOUNT_ID, DRIVE_AMOUNT_ID, DRIVE_TYPE_ID, MIX_ID, AM_AMOUNT_ID,
+                                 ROUTING_BALANCE_ID, ENV_AMOUNT_ID, LFO_DEPTH_ID })
+        capture(paramID);
+    for (int slot = 1; slot <= DualCoreDSP::NUM_MOD_SLOTS; ++slot)
+    {
+        capture("modSource" + juce::String(slot));
+        capture("modDest" + juce::String(slot));
+        capture("modAmount" + juce::String(slot));
     }
+
+    loadSnapshotsFromState();
+}
+
+void DualCoreAudioProcessor::clearSnapshot(int index)
+{
+    auto snapshots = apvts.state.getChildWithName("Snapshots");
+    snapshots.removeChild(snapshots.getChildWithName(getSnapshotType(index)), nullptr);
+    loadSnapshotsFromState();
+}
+
+bool DualCoreAudioProcessor::isSnapshotStored(int index) const
+{
+    return apvts.state.getChildWithName("Snapshots").getChildWithName(getSnapshotType(index)).isValid();
+}
+
+void DualCoreAudioProcessor::loadSnapshotsFromState()
+{
+    const auto snapshotsTree = apvts.state.getChildWithName("Snapshots");
+    std::array<DualCoreDSP::Snapshot, DualCoreDSP::NUM_SNAPSHOTS> snapshots;
+    std::array<bool, DualCoreDSP::NUM_SNAPSHOTS> stored = {};
+
+    for (int i = 0; i < DualCoreDSP::NUM_SNAPSHOTS; ++i)
+    {
+        const auto tree = snapshotsTree.getChildWithName(getSnapshotType(i));
+        if (!tree.isValid())
+            continue;
+
+        // Parameters added after the snapshot was stored read as their defaults
+        auto value = [this, &tree](const juce::String& paramID)
+        {
+            if (tree.hasProperty(paramID))
+                return static_cast<float>(tree.getProperty(paramID));
+            auto* param = apvts.getParameter(paramID);
+            return param->convertFrom0to1(param->getDefaultValue());
+        };
+        auto choice = [&value](const juce::String& paramID) { return static_cast<int>(value(paramID)); };
+
+        auto& snapshot = snapshots[static_cast<size_t>(i)];
+        snapshot.filter1Freq = value(FILTER1_FREQ_ID);
+        snapshot.filter1Reso = value(FILTER1_RESO_ID);
+        snapshot.filter1Mode = static_cast<DualCoreDSP::FilterMode>(choice(FILTER1_MODE_ID));
+        snapshot.filter1Type = static_cast<DualCoreDSP::FilterType>(choice(FILTER1_TYPE_ID));
+        snapshot.filter1Morph = value(FILTER1_MORPH_ID);
+        snapshot.filter2Freq = value(FILTER2_FREQ_ID);
+        snapshot.filter2Reso = value(FILTER2_RESO_ID);
+        snapshot.filter2Mode = static_cast<DualCoreDSP::FilterMode>(choice(FILTER2_MODE_ID));
+        snapshot.filter2Type = static_cast<DualCoreDSP::FilterType>(choice(FILTER2_TYPE_ID));
+        snapshot.filter2Morph = value(FILTER2_MORPH_ID);
+        snapshot.fmAmount = value(FM_AMOUNT_ID);
+        snapshot.driveAmount = value(DRIVE_AMOUNT_ID);
+        snapshot.driveType = static_cast<DualCoreDSP::DriveType>(choice(DRIVE_TYPE_ID));
+        snapshot.dryWetMix = value(MIX_ID) / 100.0f;
+        snapshot.amAmount = value(AM_AMOUNT_ID);
+        snapshot.routingBalance = value(ROUTING_BALANCE_ID);
+        snapshot.envAmount = value(ENV_AMOUNT_ID);
+        snapshot.lfoDepth = value(LFO_DEPTH_ID);
+
+        for (int slot = 0; slot < DualCoreDSP::NUM_MOD_SLOTS; ++slot)
+        {
+            const juce::String slotNum(slot + 1);
+            auto& modSlot = snapshot.modSlots[static_cast<size_t>(slot)];
+            modSlot.source = static_cast<DualCoreDSP::ModSource>(choice("modSource" + slotNum));
+            modSlot.destination = static_cast<DualCoreDSP::ModDestination>(choice("modDest" + slotNum));
+            modSlot.amount = value("modAmount" + slotNum) / 100.0f;
+        }
+        stored[static_cast<size_t>(i)] = true;
+    }
+
+    const juce::SpinLock::ScopedLockType lock(snapshotLock);
+    pendingSnapshots = snapshots;
+    pendingSnapshotStored = stored;
+    snapshotsChanged = true;
 }
 
 // === Preset Management ===
@@ -556,7 +1420,7 @@ void DualCoreAudioProcessor::loadPreset(const juce::File& presetFile)
     if (xml != nullptr && xml->hasTagName(apvts.state.getType()))
     {
         apvts.replaceState(juce::ValueTree::fromXml(*xml));
-        updateDSPFromParameters();
+        loadSnapshotsFromState();
     }
 }
 
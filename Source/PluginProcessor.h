@@ -48,9 +48,23 @@ public:
     std::atomic<float> outputLevelL{0.0f};
     std::atomic<float> outputLevelR{0.0f};
 
+    // Sequencer step playing at the end of the last block (for the step display)
+    std::atomic<int> sequencerStep{0};
+
+    // Snapshots: the current sound stored into a slot, kept with the plugin state and presets
+    // (message thread only). activeSnapshot is the slot playing at the end of the last block
+    void storeSnapshot(int index);
+    void clearSnapshot(int index);
+    bool isSnapshotStored(int index) const;
+    std::atomic<int> activeSnapshot{-1};  // -1 = panel settings
+
     // UI scale (saved with state)
     std::atomic<float> uiScale{1.0f};
 
+    // Analog drift seed: random per new instance, then saved with the session state (not
+    // presets), so a project recalls each instance's drift exactly
+    std::atomic<uint32_t> driftSeed{0};
+
     // Preset management
     static juce::File getPresetsFolder();
     static void ensurePresetsFolderExists();
@@ -62,26 +76,90 @@ public:
 private:
     DualCoreDSP dualCoreDSP;
 
+    // Optional output buses after the main one (Filter 1 / Filter 2 / Dry, or one filter's taps)
+    static constexpr int NUM_AUX_BUSES = 3;
+    void assignAuxOutputs(juce::AudioBuffer<float>& buffer, int numMainChannels);
+
+    // Macro parameters are read every block, so their raw values are looked up once
+    // ("macro1".., "macroSource1".., "macroDest1".., "macroMin1".., "macroMax1".., "macroCurve1"..)
+    struct MacroTargetParameters
+    {
+        std::atomic<float>* source = nullptr;
+        std::atomic<float>* destination = nullptr;
+        std::atomic<float>* rangeMin = nullptr;
+        std::atomic<float>* rangeMax = nullptr;
+        std::atomic<float>* curve = nullptr;
+    };
+    std::array<std::atomic<float>*, DualCoreDSP::NUM_MACROS> macroParameters = {};
+    std::array<MacroTargetParameters, DualCoreDSP::NUM_MACRO_TARGETS> macroTargetParameters;
+
+    // Sequencer steps, looked up once like the macros ("seqValue1".., "seqGate1".., "seqGlide1"..)
+    struct SequencerStepParameters
+    {
+        std::atomic<float>* value = nullptr;
+        std::atomic<float>* gate = nullptr;
+        std::atomic<float>* glide = nullptr;
+    };
+    std::array<SequencerStepParameters, DualCoreDSP::MAX_SEQ_STEPS> sequencerStepParameters;
+
+    // Stored snapshots live in the "Snapshots" child of the state tree ("Snapshot1".., one
+    // property per parameter ID). They are converted on the message thread and handed to the
+    // audio thread under the lock, which only ever try-locks it. Only processBlock (or
+    // prepareToPlay, before playback) applies them to the DSP
+    void loadSnapshotsFromState();
+    void applyPendingSnapshots();
+    juce::SpinLock snapshotLock;
+    std::array<DualCoreDSP::Snapshot, DualCoreDSP::NUM_SNAPSHOTS> pendingSnapshots;
+    std::array<bool, DualCoreDSP::NUM_SNAPSHOTS> pendingSnapshotStored = {};
+    bool snapshotsChanged = false;
+
     // Parameter IDs - Input Section
     static constexpr const char* INPUT_GAIN_ID = "inputGain";
     static constexpr const char* HI_BOOST_ID = "hiBoost";
     static constexpr const char* HI_CUT_ID = "hiCut";
     static constexpr const char* LIMITER_ID = "limiter";
+    static constexpr const char* OUTPUT_LIMITER_ID = "outputLimiter";
+    static constexpr const char* LIMITER_CEILING_ID = "limiterCeiling";
+    static constexpr const char* EXCLUDE_CENTRE_LFE_ID = "excludeCentreLfe";
+    static constexpr const char* AUX_MODE_ID = "auxMode";
+
+    // Input EQ
+    static constexpr const char* EQ_LOW_FREQ_ID = "eqLowFreq";
+    static constexpr const char* EQ_LOW_GAIN_ID = "eqLowGain";
+    static constexpr const char* EQ_LOW_Q_ID = "eqLowQ";
+    static constexpr const char* EQ_MID1_FREQ_ID = "eqMid1Freq";
+    static constexpr const char* EQ_MID1_GAIN_ID = "eqMid1Gain";
+    static constexpr const char* EQ_MID1_Q_ID = "eqMid1Q";
+    static constexpr const char* EQ_MID2_FREQ_ID = "eqMid2Freq";
+    static constexpr const char* EQ_MID2_GAIN_ID = "eqMid2Gain";
+    static constexpr const char* EQ_MID2_Q_ID = "eqMid2Q";
+    static constexpr const char* EQ_HIGH_FREQ_ID = "eqHighFreq";
+    static constexpr const char* EQ_HIGH_GAIN_ID = "eqHighGain";
+    static constexpr const char* EQ_HIGH_Q_ID = "eqHighQ";
 
     // Filter 1
     static constexpr const char* FILTER1_FREQ_ID = "filter1Freq";
     static constexpr const char* FILTER1_RESO_ID = "filter1Reso";
     static constexpr const char* FILTER1_MODE_ID = "filter1Mode";
     static constexpr const char* FILTER1_TYPE_ID = "filter1Type";
+    static constexpr const char* FILTER1_MORPH_ID = "filter1Morph";
 
     // Filter 2
     static constexpr const char* FILTER2_FREQ_ID = "filter2Freq";
     static constexpr const char* FILTER2_RESO_ID = "filter2Reso";
     static constexpr const char* FILTER2_MODE_ID = "filter2Mode";
     static constexpr const char* FILTER2_TYPE_ID = "filter2Type";
+    static constexpr const char* FILTER2_MORPH_ID = "filter2Morph";
+    static constexpr const char* RESO_COMP_ID = "resoComp";
 
     // FM
     static constexpr const char* FM_AMOUNT_ID = "fmAmount";
+    static constexpr const char* EXP_FREQ_MOD_ID = "expFreqMod";
+    static constexpr const char* FM_SOURCE_ID = "fmSource";
+    static constexpr const char* FM_RETURN_ID = "fmReturn";
+    static constexpr const char* FM_RETURN_EXP_ID = "fmReturnExp";
+    static constexpr const char* SELF_FM_ID = "selfFM";
+    static constexpr const char* SELF_FM_EXP_ID = "selfFMExp";
 
     // ADSR Envelope
     static constexpr const char* ENV_ATTACK_ID = "envAttack";
@@ -90,6 +168,9 @@ private:
     static constexpr const char* ENV_RELEASE_ID = "envRelease";
     static constexpr const char* ENV_AMOUNT_ID = "envAmount";
     static constexpr const char* ENV_SENS_ID = "envSens";
+    static constexpr const char* LOOKAHEAD_ID = "lookahead";
+    static constexpr const char* DETECTOR_SOURCE_ID = "detectorSource";
+    static constexpr const char* ENV_TRIGGER_ID = "envTrigger";
 
     // LFO1
     static constexpr const char* LFO_RATE_ID = "lfoRate";
@@ -100,6 +181,7 @@ private:
     // LFO1 Sync
     static constexpr const char* LFO_SYNC_ID = "lfoSync";
     static constexpr const char* LFO_DIV_ID = "lfoDiv";
+    static constexpr const char* LFO_AUDIO_RATE_ID = "lfoAudioRate";
 
     // LFO2
     static constexpr const char* LFO2_RATE_ID = "lfo2Rate";
@@ -107,6 +189,7 @@ private:
     static constexpr const char* LFO2_WAVE_ID = "lfo2Wave";
     static constexpr const char* LFO2_SYNC_ID = "lfo2Sync";
     static constexpr const char* LFO2_DIV_ID = "lfo2Div";
+    static constexpr const char* LFO2_AUDIO_RATE_ID = "lfo2AudioRate";
 
     // Modulation Matrix (6 slots)
     // Parameters are named: modSource1, modDest1, modAmount1, etc.
@@ -123,8 +206,61 @@ private:
 
     // Routing
     static constexpr const char* ROUTING_ID = "routing";
+    static constexpr const char* ROUTING_BALANCE_ID = "routingBalance";
+    static constexpr const char* FEEDBACK_AMOUNT_ID = "feedbackAmount";
+    static constexpr const char* FEEDBACK_DELAY_ID = "feedbackDelay";
     static constexpr const char* MIX_ID = "mix";
 
+    // Stereo
+    static constexpr const char* MID_SIDE_ID = "midSide";
+    static constexpr const char* SIDE_LINK_ID = "sideLink";
+    static constexpr const char* SIDE_FREQ_OFFSET_ID = "sideFreqOffset";
+    static constexpr const char* SIDE_RESO_OFFSET_ID = "sideResoOffset";
+    static constexpr const char* STEREO_SPREAD_ID = "stereoSpread";
+    static constexpr const char* DRIFT_ID = "drift";
+
+    // Unison
+    static constexpr const char* UNISON_VOICES_ID = "unisonVoices";
+    static constexpr const char* UNISON_DETUNE_ID = "unisonDetune";
+    static constexpr const char* UNISON_RESO_SPREAD_ID = "unisonResoSpread";
+
+    // Poly
+    static constexpr const char* POLY_MODE_ID = "polyMode";
+    static constexpr const char* KEY_TRACK_ID = "keyTrack";
+    static constexpr const char* LFO_RETRIGGER_ID = "lfoRetrigger";
+
+    // Step Sequencer
+    static constexpr const char* SEQ_LENGTH_ID = "seqLength";
+    static constexpr const char* SEQ_RATE_ID = "seqRate";
+    static constexpr const char* SEQ_GATE_LENGTH_ID = "seqGateLength";
+
+    // Snapshots
+    static constexpr const char* SNAPSHOT_MODE_ID = "snapshotMode";
+    static constexpr const char* SNAPSHOT_SELECT_ID = "snapshotSelect";
+    static constexpr const char* SNAPSHOT_COUNT_ID = "snapshotCount";
+    static constexpr const char* SNAPSHOT_RATE_ID = "snapshotRate";
+    static constexpr const char* SNAPSHOT_FADE_ID = "snapshotFade";
+
+    // Multiband
+    static constexpr const char* BAND_COUNT_ID = "bandCount";
+    static constexpr const char* CROSSOVER_LOW_ID = "crossoverLow";
+    static constexpr const char* CROSSOVER_MID_ID = "crossoverMid";
+    static constexpr const char* CROSSOVER_HIGH_ID = "crossoverHigh";
+    static constexpr const char* BAND1_OFFSET_ID = "band1Offset";
+    static constexpr const char* BAND1_DRIVE_ID = "band1Drive";
+    static constexpr const char* BAND1_MIX_ID = "band1Mix";
+    static constexpr const char* BAND2_OFFSET_ID = "band2Offset";
+    static constexpr const char* BAND2_DRIVE_ID = "band2Drive";
+    static constexpr const char* BAND2_MIX_ID = "band2Mix";
+    static constexpr const char* BAND3_OFFSET_ID = "band3Offset";
+    static constexpr const char* BAND3_DRIVE_ID = "band3Drive";
+    static constexpr const char* BAND3_MIX_ID = "band3Mix";
+    static constexpr const char* BAND4_OFFSET_ID = "band4Offset";
+    static constexpr const char* BAND4_DRIVE_ID = "band4Drive";
+    static constexpr const char* BAND4_MIX_ID = "band4Mix";
+
+    // Audio thread (or prepareToPlay) only: setters may reset filter state and swap the
+    // routing kernel, so restored state and presets are picked up by the next processBlock
     void updateDSPFromParameters();
 
     JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(DualCoreAudioProcessor)
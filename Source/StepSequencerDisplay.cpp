@@ -0,0 +1,167 @@
+#include "StepSequencerDisplay.h"
+
+StepSequencerDisplay::StepSequencerDisplay()
+{
+}
+
+juce::Rectangle<float> StepSequencerDisplay::getBarArea() const
+{
+    auto area = getLocalBounds().toFloat().reduced(4.0f);
+    return area.withTrimmedBottom(area.getHeight() * 0.3f);
+}
+
+juce::Rectangle<float> StepSequencerDisplay::getGateRow() const
+{
+    auto area = getLocalBounds().toFloat().reduced(4.0f);
+    return area.withTrimmedTop(area.getHeight() * 0.7f + 2.0f).withTrimmedBottom(area.getHeight() * 0.15f);
+}
+
+juce::Rectangle<float> StepSequencerDisplay::getGlideRow() const
+{
+    auto area = getLocalBounds().toFloat().reduced(4.0f);
+    return area.withTrimmedTop(area.getHeight() * 0.85f + 2.0f);
+}
+
+int StepSequencerDisplay::stepAt(float x) const
+{
+    const auto area = getBarArea();
+    const float stepWidth = area.getWidth() / static_cast<float>(length);
+    return juce::jlimit(0, length - 1, static_cast<int>((x - area.getX()) / stepWidth));
+}
+
+void StepSequencerDisplay::paint(juce::Graphics& g)
+{
+    auto bounds = getLocalBounds().toFloat();
+
+    // Background
+    g.setColour(juce::Colour(0xff121220));
+    g.fillRoundedRectangle(bounds, 4.0f);
+
+    // Border
+    g.setColour(juce::Colour(0xff3a3a5a));
+    g.drawRoundedRectangle(bounds.reduced(0.5f), 4.0f, 1.0f);
+
+    const auto bars = getBarArea();
+    const auto gateRow = getGateRow();
+    const auto glideRow = getGlideRow();
+    const float stepWidth = bars.getWidth() / static_cast<float>(length);
+    const float centreY = bars.getCentreY();
+
+    // Zero line
+    g.setColour(juce::Colour(0xff2a2a45));
+    g.drawHorizontalLine(static_cast<int>(centreY), bars.getX(), bars.getRight());
+
+    for (int i = 0; i < length; ++i)
+    {
+        const auto& step = steps[static_cast<size_t>(i)];
+        const float x = bars.getX() + stepWidth * static_cast<float>(i);
+        const float w = juce::jmax(1.0f, stepWidth - 1.0f);
+
+        // Beat grouping: every fourth step is shaded
+        if ((i / 4) % 2 == 1)
+        {
+            g.setColour(juce::Colour(0xff1a1a30));
+            g.fillRect(x, bars.getY(), stepWidth, bars.getHeight());
+        }
+
+        if (i == playStep)
+        {
+            g.setColour(juce::Colour(0xff333355));
+            g.fillRect(x, bars.getY(), stepWidth, bars.getHeight());
+        }
+
+        // Value bar, drawn from the centre line
+        const float valueY = centreY - step.value * bars.getHeight() * 0.5f;
+        g.setColour(step.gate ? juce::Colour(0xff00aaff) : juce::Colour(0xff3a3a5a));
+        g.fillRect(x, juce::jmin(valueY, centreY), w, std::abs(valueY - centreY) + 1.0f);
+
+        // Gate and glide toggles
+        g.setColour(step.gate ? juce::Colour(0xff00cc66) : juce::Colour(0xff2a2a45));
+        g.fillRect(x, gateRow.getY(), w, gateRow.getHeight());
+        g.setColour(step.glide ? juce::Colour(0xff00ccff) : juce::Colour(0xff2a2a45));
+        g.fillRect(x, glideRow.getY(), w, glideRow.getHeight());
+    }
+}
+
+void StepSequencerDisplay::mouseDown(const juce::MouseEvent& event)
+{
+    const auto position = event.position;
+    const int step = stepAt(position.x);
+    auto& s = steps[static_cast<size_t>(step)];
+
+    if (getGateRow().contains(position))
+    {
+        s.gate = !s.gate;
+        if (onGateChange)
+            onGateChange(step, s.gate);
+        repaint();
+    }
+    else if (getGlideRow().contains(position))
+    {
+        s.glide = !s.glide;
+        if (onGlideChange)
+            onGlideChange(step, s.glide);
+        repaint();
+    }
+    else
+    {
+        setValueAt(position);
+    }
+}
+
+void StepSequencerDisplay::mouseDrag(const juce::MouseEvent& event)
+{
+    // Dragging draws values across steps; toggles only respond to clicks
+    if (getBarArea().contains(event.mouseDownPosition))
+        setValueAt(event.position);
+}
+
+void StepSequencerDisplay::setValueAt(juce::Point<float> position)
+{
+    const auto bars = getBarArea();
+    const int step = stepAt(position.x);
+    const float value = juce::jlimit(-1.0f, 1.0f, (bars.getCentreY() - position.y) / (bars.getHeight() * 0.5f));
+
+    auto& s = steps[static_cast<size_t>(step)];
+    if (s.value != value)
+    {
+        s.value = value;
+        if (onValueChange)
+            onValueChange(step, value);
+        repaint();
+    }
+}
+
+void StepSequencerDisplay::setStep(int step, float value, bool gate, bool glide)
+{
+    if (step < 0 || step >= MAX_STEPS)
+        return;
+
+    auto& s = steps[static_cast<size_t>(step)];
+    if (s.value != value || s.gate != gate || s.glide != glide)
+    {
+        s.value = value;
+        s.gate = gate;
+        s.glide = glide;
+        repaint();
+    }
+}
+
+void StepSequencerDisplay::setLength(int numSteps)
+{
+    numSteps = juce::jlimit(1, MAX_STEPS, numSteps);
+    if (length != numSteps)
+    {
+        length = numSteps;
+        repaint();
+    }
+}
+
+void StepSequencerDisplay::setPlayStep(int step)
+{
+    if (playStep != step)
+    {
+        playStep = step;
+        repaint();
+    }
+}
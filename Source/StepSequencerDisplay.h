@@ -0,0 +1,49 @@
+#pragma once
+
+#include <juce_gui_basics/juce_gui_basics.h>
+#include <array>
+#include <functional>
+
+// Step editor for the sequencer mod source: a value bar per step, with gate and
+// glide toggles underneath. Edits are reported through the callbacks; the display
+// itself only mirrors the parameters it is given.
+class StepSequencerDisplay : public juce::Component
+{
+public:
+    static constexpr int MAX_STEPS = 64;
+
+    StepSequencerDisplay();
+
+    void paint(juce::Graphics& g) override;
+    void mouseDown(const juce::MouseEvent& event) override;
+    void mouseDrag(const juce::MouseEvent& event) override;
+
+    // Update displayed steps (value -1.0 to 1.0)
+    void setStep(int step, float value, bool gate, bool glide);
+    void setLength(int numSteps);
+    void setPlayStep(int step);  // -1 hides the playhead
+
+    std::function<void(int step, float value)> onValueChange;
+    std::function<void(int step, bool gate)> onGateChange;
+    std::function<void(int step, bool glide)> onGlideChange;
+
+private:
+    struct Step
+    {
+        float value = 1.0f;
+        bool gate = true;
+        bool glide = false;
+    };
+    std::array<Step, MAX_STEPS> steps;
+    int length = 16;
+    int playStep = -1;
+
+    // Layout: value bars on top, then the gate row and the glide row
+    juce::Rectangle<float> getBarArea() const;
+    juce::Rectangle<float> getGateRow() const;
+    juce::Rectangle<float> getGlideRow() const;
+    int stepAt(float x) const;
+    void setValueAt(juce::Point<float> position);
+
+    JUCE_DECLARE_NON_COPYABLE_WITH_LEAK_DETECTOR(StepSequencerDisplay)
+};